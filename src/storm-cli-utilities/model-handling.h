@@ -7,6 +7,7 @@
 
 #include "storm/utility/resources.h"
 #include "storm/utility/file.h"
+#include "storm/utility/export.h"
 #include "storm/utility/storm-version.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/NumberTraits.h"
@@ -41,6 +42,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/AbstractionSettings.h"
 #include "storm/settings/modules/ResourceSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/utility/Stopwatch.h"
 
@@ -573,16 +575,21 @@ namespace storm {
             }
         };
         
+        template<typename ValueType>
+        void verifyProperty(storm::jani::Property const& property, std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback, std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
+            printModelCheckingProperty(property);
+            storm::utility::Stopwatch watch(true);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
+            watch.stop();
+            postprocessingCallback(result);
+            printResult<ValueType>(result, property, &watch);
+        }
+        
         template<typename ValueType>
         void verifyProperties(SymbolicInput const& input, std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback, std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
             auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
             for (auto const& property : properties) {
-                printModelCheckingProperty(property);
-                storm::utility::Stopwatch watch(true);
-                std::unique_ptr<storm::modelchecker::CheckResult> result = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
-                watch.stop();
-                postprocessingCallback(result);
-                printResult<ValueType>(result, property, &watch);
+                verifyProperty<ValueType>(property, verificationCallback, postprocessingCallback);
             }
         }
         
@@ -678,26 +685,104 @@ namespace storm {
             });
         }
         
+        /*!
+         * Checks whether the given formula is of the form P=? [phi U<=t psi] (or P=? [F<=t psi]), i.e., whether it can be
+         * evaluated for several time points instead of its time bound.
+         */
+        inline bool isTimeBoundedReachabilityProbabilityFormula(storm::logic::Formula const& formula) {
+            if (!formula.isProbabilityOperatorFormula() || !formula.asProbabilityOperatorFormula().hasQuantitativeResult() || !formula.asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula()) {
+                return false;
+            }
+            storm::logic::BoundedUntilFormula const& boundedUntilFormula = formula.asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+            return !boundedUntilFormula.isMultiDimensional() && boundedUntilFormula.getTimeBoundReference().isTimeBound() && !boundedUntilFormula.hasLowerBound() && boundedUntilFormula.hasUpperBound();
+        }
+        
+        template <typename ValueType>
+        void verifyPropertyForTimePoints(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, storm::jani::Property const& property, std::vector<double> const& timePoints, std::string const& cdfFileName) {
+            printModelCheckingProperty(property);
+            storm::utility::Stopwatch watch(true);
+            auto const& states = property.getFilter().getStatesFormula();
+            bool filterForInitialStates = states->isInitialFormula();
+            auto task = storm::api::createTask<ValueType>(property.getRawFormula(), filterForInitialStates);
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = storm::api::verifyWithSparseEngine<ValueType>(ctmc, task, timePoints);
+            
+            std::unique_ptr<storm::modelchecker::CheckResult> filter;
+            if (filterForInitialStates) {
+                filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(ctmc->getInitialStates());
+            } else {
+                filter = storm::api::verifyWithSparseEngine<ValueType>(ctmc, storm::api::createTask<ValueType>(states, false));
+            }
+            if (filter) {
+                for (auto& result : results) {
+                    result->filter(filter->asQualitativeCheckResult());
+                }
+            }
+            watch.stop();
+            
+            for (uint64_t index = 0; index < timePoints.size(); ++index) {
+                STORM_PRINT("Time point " << timePoints[index] << ": ");
+                printResult<ValueType>(results[index], property);
+            }
+            STORM_PRINT("Time for model checking: " << watch << "." << std::endl);
+            
+            if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() && filterForInitialStates && ctmc->getInitialStates().getNumberOfSetBits() == 1) {
+                uint64_t initialState = *ctmc->getInitialStates().begin();
+                std::vector<std::vector<ValueType>> cdfData;
+                for (uint64_t index = 0; index < timePoints.size(); ++index) {
+                    cdfData.push_back({storm::utility::convertNumber<ValueType>(timePoints[index]), results[index]->template asExplicitQuantitativeCheckResult<ValueType>()[initialState]});
+                }
+                std::vector<std::string> headers = {"time", "probability"};
+                storm::utility::exportDataToCSVFile<ValueType, std::string, std::string>(storm::settings::getModule<storm::settings::modules::IOSettings>().getExportCdfDirectory() + cdfFileName, cdfData, headers);
+            }
+        }
+        
         template <typename ValueType>
         void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
             auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
-            verifyProperties<ValueType>(input,
-                                        [&sparseModel] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
-                                            bool filterForInitialStates = states->isInitialFormula();
-                                            auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
-                                            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, task);
-                                            
-                                            std::unique_ptr<storm::modelchecker::CheckResult> filter;
-                                            if (filterForInitialStates) {
-                                                filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
-                                            } else {
-                                                filter = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, storm::api::createTask<ValueType>(states, false));
-                                            }
-                                            if (result && filter) {
-                                                result->filter(filter->asQualitativeCheckResult());
-                                            }
-                                            return result;
-                                        });
+            
+            auto verificationCallback = [&sparseModel] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+                bool filterForInitialStates = states->isInitialFormula();
+                auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
+                std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, task);
+                
+                std::unique_ptr<storm::modelchecker::CheckResult> filter;
+                if (filterForInitialStates) {
+                    filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
+                } else {
+                    filter = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, storm::api::createTask<ValueType>(states, false));
+                }
+                if (result && filter) {
+                    result->filter(filter->asQualitativeCheckResult());
+                }
+                return result;
+            };
+            
+            auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+            if (!modelCheckerSettings.isTimePointsSet()) {
+                verifyProperties<ValueType>(input, verificationCallback);
+                return;
+            }
+            
+            // Only time-bounded reachability probabilities of CTMCs are evaluated for the given time points, all other
+            // properties are checked as usual.
+            STORM_LOG_WARN_COND(sparseModel->isOfType(storm::models::ModelType::Ctmc), "Evaluating properties for several time points is only supported for CTMCs. Ignoring the time points.");
+            std::vector<double> timePoints = modelCheckerSettings.getTimePoints();
+            auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+            uint64_t numberOfTimePointProperties = 0;
+            if (sparseModel->isOfType(storm::models::ModelType::Ctmc)) {
+                numberOfTimePointProperties = std::count_if(properties.begin(), properties.end(), [] (storm::jani::Property const& property) { return isTimeBoundedReachabilityProbabilityFormula(*property.getRawFormula()); });
+            }
+            
+            uint64_t timePointPropertyIndex = 0;
+            for (auto const& property : properties) {
+                if (sparseModel->isOfType(storm::models::ModelType::Ctmc) && isTimeBoundedReachabilityProbabilityFormula(*property.getRawFormula())) {
+                    ++timePointPropertyIndex;
+                    std::string cdfFileName = numberOfTimePointProperties == 1 ? "cdf.csv" : "cdf" + std::to_string(timePointPropertyIndex) + ".csv";
+                    verifyPropertyForTimePoints<ValueType>(sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>(), property, timePoints, cdfFileName);
+                } else {
+                    verifyProperty<ValueType>(property, verificationCallback);
+                }
+            }
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
@@ -770,6 +855,23 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "CUDD does not support the selected data-type.");
         }
         
+        template <storm::dd::DdType DdType, typename ValueType>
+        void printAndExportDdStatistics(std::shared_ptr<storm::models::ModelBase> const& model, storm::settings::modules::CoreSettings const& coreSettings) {
+            auto const& manager = model->as<storm::models::symbolic::Model<DdType, ValueType>>()->getManager();
+            if (coreSettings.isShowStatisticsSet()) {
+                std::cout << std::endl;
+                manager.printStatisticsToStream(std::cout);
+            }
+            
+            auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+            if (ioSettings.isExportDdStatisticsSet()) {
+                std::ofstream stream;
+                storm::utility::openFile(ioSettings.getExportDdStatisticsFilename(), stream);
+                manager.exportStatisticsToJson(stream);
+                storm::utility::closeFile(stream);
+            }
+        }
+        
         template <storm::dd::DdType DdType, typename ValueType>
         void verifyModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, storm::settings::modules::CoreSettings const& coreSettings) {
             if (model->isSparseModel()) {
@@ -777,6 +879,7 @@ namespace storm {
             } else {
                 STORM_LOG_ASSERT(model->isSymbolicModel(), "Unexpected model type.");
                 verifySymbolicModel<DdType, ValueType>(model, input, coreSettings);
+                printAndExportDdStatistics<DdType, ValueType>(model, coreSettings);
             }
         }
         
@@ -813,6 +916,7 @@ namespace storm {
 
             // For several engines, no model building step is performed, but the verification is started right away.
             storm::settings::modules::CoreSettings::Engine engine = coreSettings.getEngine();
+            STORM_LOG_WARN_COND(!storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isTimePointsSet() || engine == storm::settings::modules::CoreSettings::Engine::Sparse || engine == storm::settings::modules::CoreSettings::Engine::DdSparse, "Evaluating properties for several time points is only supported by the sparse engine. Ignoring the time points.");
             
             if (engine == storm::settings::modules::CoreSettings::Engine::AbstractionRefinement && abstractionSettings.getAbstractionRefinementMethod() == storm::settings::modules::AbstractionSettings::Method::Games) {
                 verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input);
@@ -263,57 +263,26 @@ namespace storm {
                 modelchecker.specifyFormula(storm::api::createTask<ValueType>(property.getRawFormula(), true));
                 modelchecker.setInstantiationsAreGraphPreserving(samples.graphPreserving);
                 
-                storm::utility::parametric::Valuation<ValueType> valuation;
-                
-                std::vector<typename utility::parametric::VariableType<ValueType>::type> parameters;
-                std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
-                std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iteratorEnds;
-                
                 storm::utility::Stopwatch watch(true);
                 for (auto const& product : samples.cartesianProducts) {
-                    parameters.clear();
-                    iterators.clear();
-                    iteratorEnds.clear();
-                    
-                    for (auto const& entry : product) {
-                        parameters.push_back(entry.first);
-                        iterators.push_back(entry.second.cbegin());
-                        iteratorEnds.push_back(entry.second.cend());
-                    }
+                    // The sample points are traversed in a reflected (snake-like) order, i.e. consecutive sample points
+                    // only differ in the value of a single parameter, which moves to a neighboring value. This way, the
+                    // solution of the previous sample point (that the model checker keeps as a hint) is a good starting
+                    // point for the next one.
+                    std::vector<storm::utility::parametric::Valuation<ValueType>> valuations = storm::utility::parametric::getValuationsOfCartesianProduct<ValueType>(product);
                     
-                    bool done = false;
-                    while (!done) {
-                        // Read off valuation.
-                        for (uint64_t i = 0; i < parameters.size(); ++i) {
-                            valuation[parameters[i]] = *iterators[i];
-                        }
-                        
-                        storm::utility::Stopwatch valuationWatch(true);
-                        std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
+                    // The instances are checked as one batch, which allows to evaluate the transition probabilities of
+                    // several instances at once. The time for an instance comprises its instantiation and its check.
+                    storm::utility::Stopwatch valuationWatch(true);
+                    modelchecker.checkBatch(Environment(), valuations, [&] (std::unique_ptr<storm::modelchecker::CheckResult>&& result, uint64_t index) {
                         valuationWatch.stop();
-                        
                         if (result) {
                             result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
                         }
-                        printInitialStatesResult<ValueType>(result, property, &valuationWatch, &valuation);
-                        
-                        for (uint64_t i = 0; i < parameters.size(); ++i) {
-                            ++iterators[i];
-                            if (iterators[i] == iteratorEnds[i]) {
-                                // Reset iterator and proceed to move next iterator.
-                                iterators[i] = product.at(parameters[i]).cbegin();
-                                
-                                // If the last iterator was removed, we are done.
-                                if (i == parameters.size() - 1) {
-                                    done = true;
-                                }
-                            } else {
-                                // If an iterator was moved but not reset, we have another valuation to check.
-                                break;
-                            }
-                        }
-                        
-                    }
+                        printInitialStatesResult<ValueType>(result, property, &valuationWatch, &valuations[index]);
+                        valuationWatch.reset();
+                        valuationWatch.start();
+                    });
                 }
                 
                 watch.stop();
@@ -21,6 +21,15 @@ namespace storm {
             return modelChecker.check(env, *this->currentCheckTask);
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        void SparseCtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations, std::function<void(std::unique_ptr<CheckResult>&&, uint64_t)> const& consumer) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            modelInstantiator.instantiateBatch(valuations, [&] (storm::models::sparse::Ctmc<ConstantType> const& instantiatedModel, uint64_t index) {
+                storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ConstantType>> modelChecker(instantiatedModel);
+                consumer(modelChecker.check(env, *this->currentCheckTask), index);
+            });
+        }
+        
         template class SparseCtmcInstantiationModelChecker<storm::models::sparse::Ctmc<storm::RationalFunction>, double>;
         template class SparseCtmcInstantiationModelChecker<storm::models::sparse::Ctmc<storm::RationalFunction>, storm::RationalNumber>;
     }
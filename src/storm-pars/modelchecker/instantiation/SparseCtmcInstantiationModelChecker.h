@@ -21,6 +21,7 @@ namespace storm {
             SparseCtmcInstantiationModelChecker(SparseModelType const& parametricModel);
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
+            virtual void checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations, std::function<void(std::unique_ptr<CheckResult>&&, uint64_t)> const& consumer) override;
             
             storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Ctmc<ConstantType>> modelInstantiator;
         };
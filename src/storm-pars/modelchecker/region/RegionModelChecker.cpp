@@ -3,6 +3,11 @@
 
 #include "storm-pars/modelchecker/region/RegionModelChecker.h"
 
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 
@@ -13,6 +18,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm-pars/settings/modules/RegionSettings.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -84,45 +90,98 @@ namespace storm {
                     displayedProgress = storm::utility::zero<CoefficientType>();
                 }
 
+                // If requested, further region model checkers analyze regions concurrently. Each region model checker
+                // analyzes a fixed subset of every batch of regions. Hence, the results do not depend on the scheduling of the threads.
+                uint64_t numberOfThreads = 1;
+                if (storm::settings::hasModule<storm::settings::modules::RegionSettings>()) {
+                    numberOfThreads = storm::settings::getModule<storm::settings::modules::RegionSettings>().getNumberOfRefinementThreads();
+                }
+#ifdef STORM_USE_CLN_RF
+                // The workers share the rational functions of the model. Copying their CLN coefficients concurrently is a data race
+                // as CLN uses non-atomic reference counts.
+                STORM_LOG_THROW(numberOfThreads == 1, storm::exceptions::NotSupportedException, "Concurrent region refinement requires rational functions over GMP numbers, but this build uses CLN numbers.");
+#endif
+                std::vector<std::unique_ptr<RegionModelChecker<ParametricType>>> workers;
+#ifdef STORM_HAVE_INTELTBB
+                for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                    auto worker = createWorker(env);
+                    if (!worker) {
+                        STORM_LOG_WARN("The selected region model checker does not support concurrent region refinement. Regions are analyzed sequentially.");
+                        workers.clear();
+                        break;
+                    }
+                    workers.push_back(std::move(worker));
+                }
+#else
+                STORM_LOG_WARN_COND(numberOfThreads == 1, "Concurrent region refinement requires Intel TBB. Regions are analyzed sequentially.");
+#endif
+                uint64_t numberOfCheckers = workers.size() + 1;
+                
                 while (fractionOfUndiscoveredArea > thresholdAsCoefficient && !unprocessedRegions.empty()) {
                     assert(unprocessedRegions.size() == refinementDepths.size());
-                    uint64_t currentDepth = refinementDepths.front();
-                    STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
-                    auto& currentRegion = unprocessedRegions.front().first;
-                    auto& res = unprocessedRegions.front().second;
-                    res = analyzeRegion(env, currentRegion, hypothesis, res, false);
-                    switch (res) {
-                        case RegionResult::AllSat:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
-                            result.push_back(std::move(unprocessedRegions.front()));
-                            break;
-                        case RegionResult::AllViolated:
-                            fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
-                            fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
-                            result.push_back(std::move(unprocessedRegions.front()));
-                            break;
-                        default:
-                            // Split the region as long as the desired refinement depth is not reached.
-                            if (!depthThreshold || currentDepth < depthThreshold.get()) {
-                                std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
-                                currentRegion.split(currentRegion.getCenterPoint(), newRegions);
-                                RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
-                                                                         ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
-                                                                          RegionResult::Unknown);
-                                for (auto& newRegion : newRegions) {
-                                    unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
-                                    refinementDepths.push(currentDepth + 1);
-                                }
-                            } else {
-                                // If the region is not further refined, it is still added to the result
-                                result.push_back(std::move(unprocessedRegions.front()));
+                    
+                    // Get the regions analyzed in this round.
+                    std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> batch;
+                    std::vector<uint64_t> batchDepths;
+                    while (batch.size() < numberOfCheckers && !unprocessedRegions.empty()) {
+                        batch.push_back(std::move(unprocessedRegions.front()));
+                        batchDepths.push_back(refinementDepths.front());
+                        unprocessedRegions.pop();
+                        refinementDepths.pop();
+                    }
+                    
+                    if (batch.size() == 1) {
+                        STORM_LOG_INFO("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << batchDepths.front() << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                        batch.front().second = analyzeRegion(env, batch.front().first, hypothesis, batch.front().second, false);
+                    } else {
+#ifdef STORM_HAVE_INTELTBB
+                        STORM_LOG_INFO("Analyzing regions #" << numOfAnalyzedRegions << " to #" << (numOfAnalyzedRegions + batch.size() - 1) << " (Refinement depth " << batchDepths.front() << " to " << batchDepths.back() << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                        tbb::parallel_for(static_cast<uint64_t>(0), numberOfCheckers, [&] (uint64_t checkerIndex) {
+                            RegionModelChecker<ParametricType>& checker = checkerIndex == 0 ? *this : *workers[checkerIndex - 1];
+                            for (uint64_t index = checkerIndex; index < batch.size(); index += numberOfCheckers) {
+                                batch[index].second = checker.analyzeRegion(env, batch[index].first, hypothesis, batch[index].second, false);
                             }
-                            break;
+                        });
+#else
+                        STORM_LOG_ASSERT(false, "Concurrent region refinement requires Intel TBB.");
+#endif
+                    }
+                    
+                    for (uint64_t index = 0; index < batch.size(); ++index) {
+                        auto& currentRegion = batch[index].first;
+                        auto const& res = batch[index].second;
+                        uint64_t currentDepth = batchDepths[index];
+                        switch (res) {
+                            case RegionResult::AllSat:
+                                fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                                fractionOfAllSatArea += currentRegion.area() / areaOfParameterSpace;
+                                result.push_back(std::move(batch[index]));
+                                break;
+                            case RegionResult::AllViolated:
+                                fractionOfUndiscoveredArea -= currentRegion.area() / areaOfParameterSpace;
+                                fractionOfAllViolatedArea += currentRegion.area() / areaOfParameterSpace;
+                                result.push_back(std::move(batch[index]));
+                                break;
+                            default:
+                                // Split the region as long as the desired refinement depth is not reached.
+                                if (!depthThreshold || currentDepth < depthThreshold.get()) {
+                                    std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                                    currentRegion.split(currentRegion.getCenterPoint(), newRegions);
+                                    RegionResult initResForNewRegions = (res == RegionResult::CenterSat) ? RegionResult::ExistsSat :
+                                                                             ((res == RegionResult::CenterViolated) ? RegionResult::ExistsViolated :
+                                                                              RegionResult::Unknown);
+                                    for (auto& newRegion : newRegions) {
+                                        unprocessedRegions.emplace(std::move(newRegion), initResForNewRegions);
+                                        refinementDepths.push(currentDepth + 1);
+                                    }
+                                } else {
+                                    // If the region is not further refined, it is still added to the result
+                                    result.push_back(std::move(batch[index]));
+                                }
+                                break;
+                        }
+                        ++numOfAnalyzedRegions;
                     }
-                    ++numOfAnalyzedRegions;
-                    unprocessedRegions.pop();
-                    refinementDepths.pop();
                     if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
                         while (displayedProgress < storm::utility::one<CoefficientType>() - fractionOfUndiscoveredArea) {
                             STORM_PRINT_AND_LOG("#");
@@ -152,6 +211,11 @@ namespace storm {
                 return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
             }
 
+        template <typename ParametricType>
+        std::unique_ptr<RegionModelChecker<ParametricType>> RegionModelChecker<ParametricType>::createWorker(Environment const& env) const {
+            return nullptr;
+        }
+        
         template <typename ParametricType>
         bool RegionModelChecker<ParametricType>::isRegionSplitEstimateSupported() const {
             return false;
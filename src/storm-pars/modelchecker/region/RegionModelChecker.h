@@ -56,9 +56,17 @@ namespace storm {
              * @param depthThreshold if given, the refinement stops at the given depth. depth=0 means no refinement.
              * @param hypothesis if not 'unknown', it is only checked whether the hypothesis holds within the given region.
              *
+             * If more than one refinement thread is set in the region settings, batches of regions are analyzed concurrently (see createWorker).
              */
             std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown);
             
+            /*!
+             * Creates a region model checker of the same kind that is specified for the same (possibly simplified) model and property,
+             * but does not share any data that is modified when analyzing regions. This allows to analyze regions concurrently.
+             * @return the new region model checker or nullptr if this is not supported by this region model checker.
+             */
+            virtual std::unique_ptr<RegionModelChecker<ParametricType>> createWorker(Environment const& env) const;
+            
             /*!
              * Returns true if region split estimation (a) was enabled when model and check task have been specified and (b) is supported by this region model checker.
              */
@@ -1,5 +1,7 @@
 #include "storm-pars/modelchecker/region/SparseParameterLiftingModelChecker.h"
 
+#include "storm-pars/settings/modules/RegionSettings.h"
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/logic/FragmentSpecification.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -8,6 +10,7 @@
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -17,7 +20,7 @@ namespace storm {
         
         template <typename SparseModelType, typename ConstantType>
         SparseParameterLiftingModelChecker<SparseModelType, ConstantType>::SparseParameterLiftingModelChecker() {
-            //Intentionally left empty
+            useMonotonicity = storm::settings::hasModule<storm::settings::modules::RegionSettings>() && storm::settings::getModule<storm::settings::modules::RegionSettings>().isUseMonotonicitySet();
         }
         
         template <typename SparseModelType, typename ConstantType>
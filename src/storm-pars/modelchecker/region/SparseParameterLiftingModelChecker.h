@@ -72,6 +72,9 @@ namespace storm {
             
             std::shared_ptr<SparseModelType> parametricModel;
             std::unique_ptr<CheckTask<storm::logic::Formula, ConstantType>> currentCheckTask;
+            
+            // Whether the parameter lifter is to exploit monotone parameters.
+            bool useMonotonicity;
 
         private:
             // store the current formula. Note that currentCheckTask only stores a reference to the formula.
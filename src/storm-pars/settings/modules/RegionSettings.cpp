@@ -1,14 +1,18 @@
 #include <storm-pars/modelchecker/region/RegionResultHypothesis.h>
 #include "storm-pars/settings/modules/RegionSettings.h"
 
+#include "storm-config.h"
+
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Argument.h"
+#include "storm/settings/SettingMemento.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/InvalidSettingsException.h"
 
 namespace storm {
     namespace settings {
@@ -23,6 +27,8 @@ namespace storm {
             const std::string RegionSettings::checkEngineOptionName = "engine";
             const std::string RegionSettings::printNoIllustrationOptionName = "noillustration";
             const std::string RegionSettings::printFullResultOptionName = "printfullresult";
+            const std::string RegionSettings::refinementThreadsOptionName = "refinethreads";
+            const std::string RegionSettings::monotonicityOptionName = "monotonicity";
             
             RegionSettings::RegionSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, regionOptionName, false, "Sets the region(s) considered for analysis.").setShortName(regionShortOptionName)
@@ -40,6 +46,11 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, checkEngineOptionName, true, "Sets which engine is used for analyzing regions.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the engine to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(engines)).setDefaultValueString("pl").build()).build());
 
+                this->addOption(storm::settings::OptionBuilder(moduleName, refinementThreadsOptionName, true, "Sets the number of threads that analyze regions concurrently during region refinement. The results only depend on this number and not on the scheduling of the threads. More than one thread requires rational functions over GMP numbers (i.e. a build with STORM_USE_CLN_RF=OFF).")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+
+                this->addOption(storm::settings::OptionBuilder(moduleName, monotonicityOptionName, true, "If set, parameter lifting does not lift parameters in which all transition probabilities (and rewards) are monotone. Monotonicity is only exploited for regions in which all parameters are nonnegative.").build());
+
                 this->addOption(storm::settings::OptionBuilder(moduleName, printNoIllustrationOptionName, false, "If set, no illustration of the result is printed.").build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, printFullResultOptionName, false, "If set, the full result for every region is printed.").build());
@@ -93,6 +104,22 @@ namespace storm {
                 return (uint64_t) depth;
             }
             
+            uint64_t RegionSettings::getNumberOfRefinementThreads() const {
+                return this->getOption(refinementThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            std::unique_ptr<storm::settings::SettingMemento> RegionSettings::overrideNumberOfRefinementThreads(uint64_t numberOfThreads) {
+                return this->overrideOption(refinementThreadsOptionName, "count", std::to_string(numberOfThreads));
+            }
+            
+            bool RegionSettings::isUseMonotonicitySet() const {
+                return this->getOption(monotonicityOptionName).getHasOptionBeenSet();
+            }
+            
+            std::unique_ptr<storm::settings::SettingMemento> RegionSettings::overrideUseMonotonicitySet(bool stateToSet) {
+                return this->overrideOption(monotonicityOptionName, stateToSet);
+            }
+            
             storm::modelchecker::RegionCheckEngine RegionSettings::getRegionCheckEngine() const {
                 std::string engineString = this->getOption(checkEngineOptionName).getArgumentByName("name").getValueAsString();
                 
@@ -118,6 +145,14 @@ namespace storm {
                 return this->getOption(printFullResultOptionName).getHasOptionBeenSet();
             }
             
+            bool RegionSettings::check() const {
+#ifdef STORM_USE_CLN_RF
+                // CLN numbers have non-atomic reference counts, so the coefficients of the shared rational functions must not be copied concurrently.
+                STORM_LOG_THROW(getNumberOfRefinementThreads() == 1, storm::exceptions::InvalidSettingsException, "Concurrent region refinement requires rational functions over GMP numbers, but this build uses CLN numbers.");
+#endif
+                return true;
+            }
+            
 
         } // namespace modules
     } // namespace settings
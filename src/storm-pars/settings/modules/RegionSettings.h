@@ -61,6 +61,34 @@ namespace storm {
                  */
                 uint64_t getDepthLimit() const;
                 
+                /*!
+                 * Retrieves the number of threads that analyze regions concurrently during region refinement.
+                 */
+                uint64_t getNumberOfRefinementThreads() const;
+                
+                /*!
+                 * Overrides the number of threads that analyze regions concurrently during region refinement. As soon
+                 * as the returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param numberOfThreads The number of threads that is to be set.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideNumberOfRefinementThreads(uint64_t numberOfThreads);
+                
+                /*!
+                 * Retrieves whether parameter lifting is to exploit the monotonicity of the transition probabilities in the parameters.
+                 */
+                bool isUseMonotonicitySet() const;
+                
+                /*!
+                 * Overrides the option to exploit monotonicity by setting it to the specified value. As soon as the
+                 * returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideUseMonotonicitySet(bool stateToSet);
+                
 				/*!
 				 * Retrieves which type of region check should be performed
 				 */
@@ -76,6 +104,8 @@ namespace storm {
                  */
                 bool isPrintFullResultSet() const;
                 
+                bool check() const override;
+                
                 const static std::string moduleName;
                 
             private:
@@ -87,6 +117,8 @@ namespace storm {
 				const static std::string checkEngineOptionName;
 				const static std::string printNoIllustrationOptionName;
 				const static std::string printFullResultOptionName;
+				const static std::string refinementThreadsOptionName;
+				const static std::string monotonicityOptionName;
             };
             
         } // namespace modules
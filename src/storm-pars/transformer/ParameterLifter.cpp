@@ -1,19 +1,31 @@
 #include "storm-pars/transformer/ParameterLifter.h"
 
+#include <unordered_set>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/UnexpectedException.h"
-#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace transformer {
 
         template<typename ParametricType, typename ConstantType>
-        ParameterLifter<ParametricType, ConstantType>::ParameterLifter(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns, bool generateRowLabels) {
+        ParameterLifter<ParametricType, ConstantType>::ParameterLifter(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns, bool generateRowLabels, bool useMonotonicity) {
         
+            if (useMonotonicity) {
+                computeMonotoneParameters(pMatrix, pVector, selectedRows, selectedColumns);
+                if (!increasingParameters.empty() || !decreasingParameters.empty()) {
+                    // Keep the input as monotone parameters need to be lifted for regions that allow negative parameter values.
+                    liftingInput = std::make_unique<LiftingInput>(LiftingInput {pMatrix, pVector, selectedRows, selectedColumns, generateRowLabels});
+                }
+            }
+            liftParameters(pMatrix, pVector, selectedRows, selectedColumns, generateRowLabels);
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::liftParameters(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns, bool generateRowLabels) {
             
             // get a mapping from old column indices to new ones
             std::vector<uint_fast64_t> oldToNewColumnIndexMapping(selectedColumns.size(), selectedColumns.size());
@@ -60,8 +72,24 @@ namespace storm {
                 }
                 ++pVectorEntryCount;
                 
+                // Parameters in which all entries are monotone are not lifted.
+                std::vector<VariableType> monotoneVariables;
+                for (auto varIt = occurringVariables.begin(); varIt != occurringVariables.end();) {
+                    if (increasingParameters.count(*varIt) > 0 || decreasingParameters.count(*varIt) > 0) {
+                        monotoneVariables.push_back(*varIt);
+                        varIt = occurringVariables.erase(varIt);
+                    } else {
+                        ++varIt;
+                    }
+                }
+                
                 // Compute the (abstract) valuation for each row
                 auto rowValuations = getVerticesOfAbstractRegion(occurringVariables);
+                for (auto& val : rowValuations) {
+                    for (auto const& var : monotoneVariables) {
+                        addMonotoneParameter(val, var);
+                    }
+                }
                 
                 for (auto const& val : rowValuations) {
                     if (generateRowLabels) {
@@ -89,9 +117,11 @@ namespace storm {
                         vector.push_back(storm::utility::one<ConstantType>());
                         AbstractValuation vectorVal(val);
                         for(auto const& vectorVar : vectorEntryVariables) {
-                            if (occurringVariables.find(vectorVar) == occurringVariables.end()) {
-                                assert(!generateRowLabels);
-                                vectorVal.addParameterUnspecified(vectorVar);
+                            if (occurringVariables.find(vectorVar) == occurringVariables.end() && std::find(monotoneVariables.begin(), monotoneVariables.end(), vectorVar) == monotoneVariables.end()) {
+                                if (!addMonotoneParameter(vectorVal, vectorVar)) {
+                                    assert(!generateRowLabels);
+                                    vectorVal.addParameterUnspecified(vectorVar);
+                                }
                             }
                         }
                         ConstantType& placeholder = functionValuationCollector.add(pVectorEntry, vectorVal);
@@ -137,6 +167,31 @@ namespace storm {
     
         template<typename ParametricType, typename ConstantType>
         void ParameterLifter<ParametricType, ConstantType>::specifyRegion(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
+            // The monotonicity of the parameters is derived from the signs of the coefficients and is thus only known if all
+            // parameters are nonnegative. If the region allows a negative value for any parameter, all parameters are lifted from now on.
+            bool monotoneParametersChanged = false;
+            if (!increasingParameters.empty() || !decreasingParameters.empty()) {
+                for (auto const& parameter : region.getVariables()) {
+                    if (region.getLowerBoundary(parameter) < storm::utility::zero<CoefficientType>()) {
+                        STORM_LOG_INFO("The region " << region.toString() << " allows negative values for the parameter " << parameter << ". All monotone parameters are lifted.");
+                        increasingParameters.clear();
+                        decreasingParameters.clear();
+                        monotoneParametersChanged = true;
+                        break;
+                    }
+                }
+            }
+            if (monotoneParametersChanged) {
+                STORM_LOG_ASSERT(liftingInput, "The input of the parameter lifting is not available.");
+                functionValuationCollector = FunctionValuationCollector();
+                rowLabels.clear();
+                vector.clear();
+                matrixAssignment.clear();
+                vectorAssignment.clear();
+                liftParameters(liftingInput->pMatrix, liftingInput->pVector, liftingInput->selectedRows, liftingInput->selectedColumns, liftingInput->generateRowLabels);
+                liftingInput = nullptr;
+            }
+            
             // write the evaluation result of each function,evaluation pair into the placeholders
             functionValuationCollector.evaluateCollectedFunctions(region, dirForParameters);
             
@@ -161,6 +216,16 @@ namespace storm {
             return vector;
         }
         
+        template<typename ParametricType, typename ConstantType>
+        std::set<typename ParameterLifter<ParametricType, ConstantType>::VariableType> const& ParameterLifter<ParametricType, ConstantType>::getIncreasingParameters() const {
+            return increasingParameters;
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        std::set<typename ParameterLifter<ParametricType, ConstantType>::VariableType> const& ParameterLifter<ParametricType, ConstantType>::getDecreasingParameters() const {
+            return decreasingParameters;
+        }
+        
         template<typename ParametricType, typename ConstantType>
         std::vector<typename ParameterLifter<ParametricType, ConstantType>::AbstractValuation> const& ParameterLifter<ParametricType, ConstantType>::getRowLabels() const {
             return rowLabels;
@@ -187,10 +252,59 @@ namespace storm {
             }
             return result;
         }
+        
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::computeMonotoneParameters(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns) {
+            std::map<VariableType, storm::utility::parametric::Monotonicity> monotonicities;
+            std::unordered_set<ParametricType> processedFunctions;
+            auto processFunction = [&] (ParametricType const& function) {
+                if (storm::utility::isConstant(function) || !processedFunctions.insert(function).second) {
+                    return;
+                }
+                std::set<VariableType> variables;
+                storm::utility::parametric::gatherOccurringVariables(function, variables);
+                for (auto const& var : variables) {
+                    auto monotonicityIt = monotonicities.emplace(var, storm::utility::parametric::Monotonicity::Constant).first;
+                    if (monotonicityIt->second != storm::utility::parametric::Monotonicity::Unknown) {
+                        monotonicityIt->second = storm::utility::parametric::combineMonotonicity(monotonicityIt->second, storm::utility::parametric::checkMonotonicity(function, var));
+                    }
+                }
+            };
+            
+            for (auto const& rowIndex : selectedRows) {
+                for (auto const& entry : pMatrix.getRow(rowIndex)) {
+                    if (selectedColumns.get(entry.getColumn())) {
+                        processFunction(entry.getValue());
+                    }
+                }
+                processFunction(pVector[rowIndex]);
+            }
+            
+            for (auto const& varMonotonicity : monotonicities) {
+                if (varMonotonicity.second == storm::utility::parametric::Monotonicity::Increasing) {
+                    increasingParameters.insert(varMonotonicity.first);
+                } else if (varMonotonicity.second == storm::utility::parametric::Monotonicity::Decreasing) {
+                    decreasingParameters.insert(varMonotonicity.first);
+                }
+            }
+            STORM_LOG_INFO("Parameter lifting found " << increasingParameters.size() << " increasing and " << decreasingParameters.size() << " decreasing out of " << monotonicities.size() << " parameters.");
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        bool ParameterLifter<ParametricType, ConstantType>::addMonotoneParameter(AbstractValuation& valuation, VariableType const& var) const {
+            if (increasingParameters.count(var) > 0) {
+                valuation.addParameterIncreasing(var);
+                return true;
+            } else if (decreasingParameters.count(var) > 0) {
+                valuation.addParameterDecreasing(var);
+                return true;
+            }
+            return false;
+        }
 
         template<typename ParametricType, typename ConstantType>
         bool ParameterLifter<ParametricType, ConstantType>::AbstractValuation::operator==(AbstractValuation const& other) const {
-            return this->lowerPars == other.lowerPars && this->upperPars == other.upperPars && this->unspecifiedPars == other.unspecifiedPars;
+            return this->lowerPars == other.lowerPars && this->upperPars == other.upperPars && this->unspecifiedPars == other.unspecifiedPars && this->increasingPars == other.increasingPars && this->decreasingPars == other.decreasingPars;
         }
         
         template<typename ParametricType, typename ConstantType>
@@ -208,6 +322,16 @@ namespace storm {
             unspecifiedPars.insert(var);
         }
         
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::AbstractValuation::addParameterIncreasing(VariableType const& var) {
+            increasingPars.insert(var);
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        void ParameterLifter<ParametricType, ConstantType>::AbstractValuation::addParameterDecreasing(VariableType const& var) {
+            decreasingPars.insert(var);
+        }
+        
         template<typename ParametricType, typename ConstantType>
         std::size_t ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getHashValue() const {
             std::size_t seed = 0;
@@ -220,6 +344,12 @@ namespace storm {
             for (auto const& p : unspecifiedPars) {
                 carl::hash_add(seed, p);
             }
+            for (auto const& p : increasingPars) {
+                carl::hash_add(seed, p);
+            }
+            for (auto const& p : decreasingPars) {
+                carl::hash_add(seed, p);
+            }
             return seed;
         }
     
@@ -233,6 +363,10 @@ namespace storm {
                     result.addParameterUpper(p);
                 } else if (std::find(unspecifiedPars.begin(), unspecifiedPars.end(), p) != unspecifiedPars.end()) {
                     result.addParameterUnspecified(p);
+                } else if (std::find(increasingPars.begin(), increasingPars.end(), p) != increasingPars.end()) {
+                    result.addParameterIncreasing(p);
+                } else if (std::find(decreasingPars.begin(), decreasingPars.end(), p) != decreasingPars.end()) {
+                    result.addParameterDecreasing(p);
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "Tried to obtain a subvaluation for parameters that are not specified by this valuation");
                 }
@@ -256,9 +390,26 @@ namespace storm {
         }
         
         template<typename ParametricType, typename ConstantType>
-        std::vector<storm::utility::parametric::Valuation<ParametricType>> ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getConcreteValuations(storm::storage::ParameterRegion<ParametricType> const& region) const {
+        std::set<typename ParameterLifter<ParametricType, ConstantType>::VariableType> const& ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getIncreasingParameters() const {
+            return increasingPars;
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        std::set<typename ParameterLifter<ParametricType, ConstantType>::VariableType> const& ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getDecreasingParameters() const {
+            return decreasingPars;
+        }
+        
+        template<typename ParametricType, typename ConstantType>
+        std::vector<storm::utility::parametric::Valuation<ParametricType>> ParameterLifter<ParametricType, ConstantType>::AbstractValuation::getConcreteValuations(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) const {
             auto result = region.getVerticesOfRegion(unspecifiedPars);
+            bool maximize = storm::solver::maximize(dirForParameters);
             for(auto& valuation : result) {
+                for (auto const& increasingPar : increasingPars) {
+                    valuation.insert(std::pair<VariableType, CoefficientType>(increasingPar, maximize ? region.getUpperBoundary(increasingPar) : region.getLowerBoundary(increasingPar)));
+                }
+                for (auto const& decreasingPar : decreasingPars) {
+                    valuation.insert(std::pair<VariableType, CoefficientType>(decreasingPar, maximize ? region.getLowerBoundary(decreasingPar) : region.getUpperBoundary(decreasingPar)));
+                }
                 for (auto const& lowerPar : lowerPars) {
                     valuation.insert(std::pair<VariableType, CoefficientType>(lowerPar, region.getLowerBoundary(lowerPar)));
                 }
@@ -289,7 +440,7 @@ namespace storm {
                 AbstractValuation const& abstrValuation = collectedFunctionValuationPlaceholder.first.second;
                 ConstantType& placeholder = collectedFunctionValuationPlaceholder.second;
                 
-                auto concreteValuations = abstrValuation.getConcreteValuations(region);
+                auto concreteValuations = abstrValuation.getConcreteValuations(region, dirForUnspecifiedParameters);
                 auto concreteValuationIt = concreteValuations.begin();
                 placeholder = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, *concreteValuationIt));
                 for(++concreteValuationIt; concreteValuationIt != concreteValuations.end(); ++concreteValuationIt) {
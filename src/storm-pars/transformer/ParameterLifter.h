@@ -23,6 +23,10 @@ namespace storm {
          * However, if a vector entry considers a parameter that does not occur in the corresponding matrix row,
          * the parameter is directly set such that the vector entry is maximized (or minimized, depending on the specified optimization direction).
          *
+         * If monotonicity is exploited, parameters in which all considered matrix and vector entries are monotone (in the same direction) are not lifted.
+         * As the resulting values only depend on the entries in a monotone way, such parameters are directly set to the bound that optimizes the result.
+         * This reduces the number of rows in a row group (and the number of function evaluations) by a factor of 2 for each such parameter.
+         *
          * @note The row grouping of the original matrix is ignored.
          */
         template<typename ParametricType, typename ConstantType>
@@ -38,17 +42,26 @@ namespace storm {
              * @param pVector the parametric vector (the vector size should equal the row count of the matrix)
              * @param selectedRows a Bitvector that specifies which rows of the matrix and the vector are considered.
              * @param selectedColumns a Bitvector that specifies which columns of the matrix are considered.
+             * @param generateRowLabels if true, the abstract valuation of each row is stored.
+             * @param useMonotonicity if true, parameters in which the considered entries are monotone are not lifted. This requires that
+             *        the vector is nonnegative. As monotonicity is only known if all parameters are nonnegative, all monotone parameters are
+             *        lifted (and the result is rebuilt) once a region allows a negative value for any parameter. The given matrix then has to outlive the lifter.
              */
-            ParameterLifter(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns,  bool generateRowLabels = false);
+            ParameterLifter(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns,  bool generateRowLabels = false, bool useMonotonicity = false);
             
             void specifyRegion(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
             
-            // Returns the resulting matrix. Should only be called AFTER specifying a region
+            // Returns the resulting matrix. Should only be called AFTER specifying a region.
+            // Note that specifying a region may add rows to the row groups (if monotone parameters need to be lifted).
             storm::storage::SparseMatrix<ConstantType> const& getMatrix() const;
             
             // Returns the resulting vector. Should only be called AFTER specifying a region
             std::vector<ConstantType> const& getVector() const;
             
+            // Returns the parameters in which all considered entries are monotonically increasing (decreasing). These are empty if monotonicity is not used.
+            std::set<VariableType> const& getIncreasingParameters() const;
+            std::set<VariableType> const& getDecreasingParameters() const;
+            
             /*
              * During initialization, the actual regions are not known. Hence, we consider abstract valuations,
              * where it is only known whether a parameter will be set to either the lower/upper bound of the region or whether this is unspecified
@@ -62,21 +75,26 @@ namespace storm {
                 void addParameterLower(VariableType const& var);
                 void addParameterUpper(VariableType const& var);
                 void addParameterUnspecified(VariableType const& var);
+                void addParameterIncreasing(VariableType const& var);
+                void addParameterDecreasing(VariableType const& var);
                 
                 std::size_t getHashValue() const;
                 AbstractValuation getSubValuation(std::set<VariableType> const& pars) const;
                 std::set<VariableType> const& getLowerParameters() const;
                 std::set<VariableType> const& getUpperParameters() const;
                 std::set<VariableType> const& getUnspecifiedParameters() const;
+                std::set<VariableType> const& getIncreasingParameters() const;
+                std::set<VariableType> const& getDecreasingParameters() const;
                 
                 /*!
                  * Returns the concrete valuation(s) (w.r.t. the provided region) represented by this abstract valuation.
                  * Note that an abstract valuation represents 2^(#unspecified parameters) many concrete valuations.
+                 * Increasing (decreasing) parameters are set to the upper (lower) bound if the parameters maximize and vice versa.
                  */
-                std::vector<storm::utility::parametric::Valuation<ParametricType>> getConcreteValuations(storm::storage::ParameterRegion<ParametricType> const& region) const;
+                std::vector<storm::utility::parametric::Valuation<ParametricType>> getConcreteValuations(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) const;
                 
             private:
-                std::set<VariableType> lowerPars, upperPars, unspecifiedPars;
+                std::set<VariableType> lowerPars, upperPars, unspecifiedPars, increasingPars, decreasingPars;
             };
             
             // Returns for each row the abstract valuation for this row
@@ -124,10 +142,35 @@ namespace storm {
             };
             
             FunctionValuationCollector functionValuationCollector;
+            
+            // Builds the resulting matrix and vector, lifting all parameters that are not (or no longer) considered to be monotone.
+            void liftParameters(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns, bool generateRowLabels);
+            
+            // The input of the lifting, which is only kept if there are monotone parameters.
+            struct LiftingInput {
+                storm::storage::SparseMatrix<ParametricType> const& pMatrix;
+                std::vector<ParametricType> pVector;
+                storm::storage::BitVector selectedRows;
+                storm::storage::BitVector selectedColumns;
+                bool generateRowLabels;
+            };
+            std::unique_ptr<LiftingInput> liftingInput;
     
             // Returns the 2^(variables.size()) vertices of the region
             std::vector<AbstractValuation> getVerticesOfAbstractRegion(std::set<VariableType> const& variables) const;
             
+            /*!
+             * Computes the parameters in which all considered matrix and vector entries are monotone.
+             * If all entries are nonnegative and increasing (decreasing) in a parameter, so are the (bounded or unbounded)
+             * sums of matrix powers times the vector, i.e., the values of all states for any scheduler.
+             */
+            void computeMonotoneParameters(storm::storage::SparseMatrix<ParametricType> const& pMatrix, std::vector<ParametricType> const& pVector, storm::storage::BitVector const& selectedRows, storm::storage::BitVector const& selectedColumns);
+            
+            // Adds the given parameter as increasing or decreasing parameter to the given valuation. Returns false if the parameter is not monotone.
+            bool addMonotoneParameter(AbstractValuation& valuation, VariableType const& var) const;
+            
+            std::set<VariableType> increasingParameters, decreasingParameters;
+            
             std::vector<AbstractValuation> rowLabels;
 
             storm::storage::SparseMatrix<ConstantType> matrix; //The resulting matrix;
@@ -0,0 +1,175 @@
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+
+#include <algorithm>
+#include <set>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+#ifdef STORM_HAVE_CARL
+            CompiledRationalFunctions::CompiledRationalFunctions(std::vector<storm::RationalFunction> const& functions) : numberOfRegisters(0) {
+                // Gather the occurring variables. They are stored in the first registers.
+                std::set<storm::RationalFunctionVariable> variableSet;
+                for (auto const& function : functions) {
+                    gatherOccurringVariables(function, variableSet);
+                }
+                variables.assign(variableSet.begin(), variableSet.end());
+                for (auto const& variable : variables) {
+                    variableIndices.emplace(variable, numberOfRegisters);
+                    ++numberOfRegisters;
+                }
+
+                // Translate the functions. Polynomials that occur several times are only translated once.
+                std::map<Polynomial, uint64_t> compiledPolynomials;
+                this->functions.reserve(functions.size());
+                for (auto const& function : functions) {
+                    storm::RawPolynomial numerator = function.nominatorAsPolynomial().coefficient() * function.nominatorAsPolynomial().polynomial();
+                    storm::RawPolynomial denominator = function.denominatorAsPolynomial().coefficient() * function.denominatorAsPolynomial().polynomial();
+                    uint64_t numeratorRegister = compilePolynomial(numerator, compiledPolynomials);
+                    uint64_t denominatorRegister = compilePolynomial(denominator, compiledPolynomials);
+                    this->functions.emplace_back(numeratorRegister, denominatorRegister);
+                }
+                STORM_LOG_DEBUG("Compiled " << functions.size() << " functions into " << compiledPolynomials.size() << " polynomials with " << instructions.size() << " instructions and " << constantRegisters.size() << " constants.");
+            }
+
+            uint64_t CompiledRationalFunctions::compilePolynomial(storm::RawPolynomial const& polynomial, std::map<Polynomial, uint64_t>& compiledPolynomials) {
+                Polynomial terms;
+                for (auto const& term : polynomial) {
+                    Monomial monomial;
+                    if (term.monomial()) {
+                        for (auto const& factor : *term.monomial()) {
+                            monomial.emplace_back(variableIndices.at(factor.first), factor.second);
+                        }
+                        std::sort(monomial.begin(), monomial.end());
+                    }
+                    terms.emplace_back(std::move(monomial), storm::utility::convertNumber<double>(term.coeff()));
+                }
+                std::sort(terms.begin(), terms.end());
+                return compileHorner(terms, compiledPolynomials);
+            }
+
+            uint64_t CompiledRationalFunctions::compileHorner(Polynomial const& polynomial, std::map<Polynomial, uint64_t>& compiledPolynomials) {
+                auto findRes = compiledPolynomials.find(polynomial);
+                if (findRes != compiledPolynomials.end()) {
+                    return findRes->second;
+                }
+
+                // Find the variable that occurs in most terms.
+                std::map<uint64_t, uint64_t> numberOfOccurrences;
+                for (auto const& term : polynomial) {
+                    for (auto const& factor : term.first) {
+                        ++numberOfOccurrences[factor.first];
+                    }
+                }
+
+                uint64_t result;
+                if (numberOfOccurrences.empty()) {
+                    double constant = storm::utility::zero<double>();
+                    for (auto const& term : polynomial) {
+                        constant += term.second;
+                    }
+                    result = getConstantRegister(constant);
+                } else {
+                    uint64_t variableIndex = std::max_element(numberOfOccurrences.begin(), numberOfOccurrences.end(), [] (std::pair<uint64_t const, uint64_t> const& lhs, std::pair<uint64_t const, uint64_t> const& rhs) { return lhs.second < rhs.second; })->first;
+
+                    // Decompose the polynomial into variable * quotient + remainder.
+                    Polynomial quotient, remainder;
+                    for (auto const& term : polynomial) {
+                        auto factorIt = std::find_if(term.first.begin(), term.first.end(), [&variableIndex] (std::pair<uint64_t, uint64_t> const& factor) { return factor.first == variableIndex; });
+                        if (factorIt == term.first.end()) {
+                            remainder.push_back(term);
+                        } else {
+                            Monomial monomial = term.first;
+                            auto reducedFactorIt = monomial.begin() + (factorIt - term.first.begin());
+                            if (--reducedFactorIt->second == 0) {
+                                monomial.erase(reducedFactorIt);
+                            }
+                            quotient.emplace_back(std::move(monomial), term.second);
+                        }
+                    }
+                    // Reducing the exponents may change the order of the terms (whereas the remainder remains sorted).
+                    std::sort(quotient.begin(), quotient.end());
+
+                    uint64_t quotientRegister = compileHorner(quotient, compiledPolynomials);
+                    uint64_t remainderRegister = remainder.empty() ? 0 : compileHorner(remainder, compiledPolynomials);
+                    result = numberOfRegisters++;
+                    instructions.push_back({result, variableIndex, quotientRegister, !remainder.empty(), remainderRegister});
+                }
+                compiledPolynomials.emplace(polynomial, result);
+                return result;
+            }
+
+            uint64_t CompiledRationalFunctions::getConstantRegister(double constant) {
+                auto registerIt = constantRegisters.find(constant);
+                if (registerIt == constantRegisters.end()) {
+                    registerIt = constantRegisters.emplace(constant, numberOfRegisters++).first;
+                }
+                return registerIt->second;
+            }
+
+            std::vector<storm::RationalFunctionVariable> const& CompiledRationalFunctions::getVariables() const {
+                return variables;
+            }
+
+            uint64_t CompiledRationalFunctions::getNumberOfFunctions() const {
+                return functions.size();
+            }
+
+            void CompiledRationalFunctions::evaluate(std::vector<Valuation<storm::RationalFunction>> const& valuations, std::vector<double>& result) const {
+                uint64_t blockSize = valuations.size();
+                std::vector<double> variableValues(variables.size() * blockSize);
+                for (uint64_t lane = 0; lane < blockSize; ++lane) {
+                    for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+                        auto valueIt = valuations[lane].find(variables[variableIndex]);
+                        STORM_LOG_THROW(valueIt != valuations[lane].end(), storm::exceptions::InvalidArgumentException, "The valuation does not assign a value to variable " << variables[variableIndex] << ".");
+                        variableValues[variableIndex * blockSize + lane] = storm::utility::convertNumber<double>(valueIt->second);
+                    }
+                }
+                evaluate(blockSize, variableValues, result);
+            }
+
+            void CompiledRationalFunctions::evaluate(uint64_t blockSize, std::vector<double> const& variableValues, std::vector<double>& result) const {
+                STORM_LOG_ASSERT(variableValues.size() == variables.size() * blockSize, "Unexpected number of variable values.");
+
+                // Set the variables and constants and evaluate the polynomials.
+                std::vector<double> registers(numberOfRegisters * blockSize);
+                std::copy(variableValues.begin(), variableValues.end(), registers.begin());
+                for (auto const& constantRegister : constantRegisters) {
+                    std::fill_n(registers.begin() + constantRegister.second * blockSize, blockSize, constantRegister.first);
+                }
+                for (auto const& instruction : instructions) {
+                    double* target = registers.data() + instruction.target * blockSize;
+                    double const* left = registers.data() + instruction.left * blockSize;
+                    double const* right = registers.data() + instruction.right * blockSize;
+                    if (instruction.hasAddend) {
+                        double const* addend = registers.data() + instruction.addend * blockSize;
+                        for (uint64_t lane = 0; lane < blockSize; ++lane) {
+                            target[lane] = left[lane] * right[lane] + addend[lane];
+                        }
+                    } else {
+                        for (uint64_t lane = 0; lane < blockSize; ++lane) {
+                            target[lane] = left[lane] * right[lane];
+                        }
+                    }
+                }
+
+                // Finally, divide the numerators by the denominators.
+                result.resize(functions.size() * blockSize);
+                for (uint64_t functionIndex = 0; functionIndex < functions.size(); ++functionIndex) {
+                    double* target = result.data() + functionIndex * blockSize;
+                    double const* numerator = registers.data() + functions[functionIndex].first * blockSize;
+                    double const* denominator = registers.data() + functions[functionIndex].second * blockSize;
+                    for (uint64_t lane = 0; lane < blockSize; ++lane) {
+                        target[lane] = numerator[lane] / denominator[lane];
+                    }
+                }
+            }
+#endif
+        }
+    }
+}
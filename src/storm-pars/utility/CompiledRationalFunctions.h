@@ -0,0 +1,108 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace utility {
+        namespace parametric {
+
+            /*!
+             * Compiles a collection of rational functions into a straight-line program that evaluates all of them in
+             * floating point arithmetic. Each polynomial is evaluated according to a (greedy) multivariate Horner scheme,
+             * i.e., it is recursively decomposed into p = x * q + r, where x is the variable occurring in most terms of p
+             * and r consists of the terms of p that do not contain x. Polynomials (including the ones arising in this
+             * decomposition) that occur several times are computed only once. The program is evaluated for a whole block
+             * of valuations at once, where the values of the different valuations are stored consecutively so that each
+             * instruction is applied to the complete block in one (vectorizable) loop.
+             */
+            class CompiledRationalFunctions {
+            public:
+                /*!
+                 * Compiles the given functions.
+                 */
+                CompiledRationalFunctions(std::vector<storm::RationalFunction> const& functions);
+
+                /*!
+                 * Retrieves the variables occurring in the functions (in the order expected by evaluate).
+                 */
+                std::vector<storm::RationalFunctionVariable> const& getVariables() const;
+
+                /*!
+                 * Retrieves the number of compiled functions.
+                 */
+                uint64_t getNumberOfFunctions() const;
+
+                /*!
+                 * Evaluates all functions for a block of valuations.
+                 *
+                 * @param valuations The valuations. Each valuation has to assign a value to every occurring variable.
+                 * @param result The values of the functions, where the value of function i under valuation j is
+                 * written to position i * valuations.size() + j.
+                 */
+                void evaluate(std::vector<Valuation<storm::RationalFunction>> const& valuations, std::vector<double>& result) const;
+
+                /*!
+                 * Evaluates all functions for a block of valuations given as raw values.
+                 *
+                 * @param blockSize The number of valuations.
+                 * @param variableValues The value of variable i (as given by getVariables) under valuation j is expected
+                 * at position i * blockSize + j.
+                 * @param result The values of the functions, where the value of function i under valuation j is
+                 * written to position i * blockSize + j.
+                 */
+                void evaluate(uint64_t blockSize, std::vector<double> const& variableValues, std::vector<double>& result) const;
+
+            private:
+                // A monomial given by the indices of its variables and their exponents (sorted by the variable index).
+                typedef std::vector<std::pair<uint64_t, uint64_t>> Monomial;
+                // A polynomial given by its monomials and their coefficients (sorted by the monomials).
+                typedef std::vector<std::pair<Monomial, double>> Polynomial;
+
+                // The instruction target = left * right (+ addend, if present).
+                struct Instruction {
+                    uint64_t target;
+                    uint64_t left;
+                    uint64_t right;
+                    bool hasAddend;
+                    uint64_t addend;
+                };
+
+                /*!
+                 * Translates the given polynomial and retrieves the register that holds its value.
+                 */
+                uint64_t compilePolynomial(storm::RawPolynomial const& polynomial, std::map<Polynomial, uint64_t>& compiledPolynomials);
+
+                /*!
+                 * Creates the instructions for evaluating the given polynomial according to the Horner scheme (if the
+                 * polynomial has not been compiled before) and retrieves the register that holds its value.
+                 */
+                uint64_t compileHorner(Polynomial const& polynomial, std::map<Polynomial, uint64_t>& compiledPolynomials);
+
+                /*!
+                 * Retrieves the register holding the given constant.
+                 */
+                uint64_t getConstantRegister(double constant);
+
+                // The occurring variables. The first registers hold the values of these variables.
+                std::vector<storm::RationalFunctionVariable> variables;
+                std::map<storm::RationalFunctionVariable, uint64_t> variableIndices;
+
+                // The registers holding constants together with their values.
+                std::map<double, uint64_t> constantRegisters;
+
+                // The number of used registers.
+                uint64_t numberOfRegisters;
+
+                // The instructions (in the order of execution).
+                std::vector<Instruction> instructions;
+
+                // For each function, the registers holding the values of the numerator and the denominator.
+                std::vector<std::pair<uint64_t, uint64_t>> functions;
+            };
+
+        }
+    }
+}
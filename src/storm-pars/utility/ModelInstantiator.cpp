@@ -142,6 +142,12 @@ namespace storm {
                             storm::utility::parametric::evaluate(functionResult.first, valuation));
                 }
                 
+                applyPlaceholders();
+                return *this->instantiatedModel;
+            }
+        
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::applyPlaceholders() {
                 //Write the instantiated values to the matrices and vectors according to the stored mappings
                 for(auto& entryValuePair : this->matrixMapping){
                     entryValuePair.first->setValue(*(entryValuePair.second));
@@ -149,8 +155,54 @@ namespace storm {
                 for(auto& entryValuePair : this->vectorMapping){
                     *(entryValuePair.first)=*(entryValuePair.second);
                 }
+            }
+        
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiateBatch(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations, std::function<void(ConstantSparseModelType const&, uint64_t)> const& consumer) {
+                instantiateBatchInternal(valuations, consumer);
+            }
+        
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            template<typename CT>
+            typename std::enable_if<std::is_same<CT, double>::value>::type
+            ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiateBatchInternal(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations, std::function<void(ConstantSparseModelType const&, uint64_t)> const& consumer) {
+                if (!compiledFunctions) {
+                    std::vector<ParametricType> functionVector;
+                    functionVector.reserve(this->functions.size());
+                    compiledFunctionPlaceholders.reserve(this->functions.size());
+                    for (auto& functionResult : this->functions) {
+                        functionVector.push_back(functionResult.first);
+                        compiledFunctionPlaceholders.push_back(&functionResult.second);
+                    }
+                    compiledFunctions = std::make_unique<storm::utility::parametric::CompiledRationalFunctions>(functionVector);
+                }
                 
-                return *this->instantiatedModel;
+                // Evaluate the functions for blocks of valuations and then write the instances one after another.
+                uint64_t const blockSize = 64;
+                std::vector<storm::utility::parametric::Valuation<ParametricType>> block;
+                std::vector<double> blockResult;
+                for (uint64_t blockStart = 0; blockStart < valuations.size(); blockStart += blockSize) {
+                    uint64_t blockEnd = std::min<uint64_t>(blockStart + blockSize, valuations.size());
+                    block.assign(valuations.begin() + blockStart, valuations.begin() + blockEnd);
+                    compiledFunctions->evaluate(block, blockResult);
+                    for (uint64_t lane = 0; lane < block.size(); ++lane) {
+                        for (uint64_t functionIndex = 0; functionIndex < compiledFunctionPlaceholders.size(); ++functionIndex) {
+                            *compiledFunctionPlaceholders[functionIndex] = blockResult[functionIndex * block.size() + lane];
+                        }
+                        applyPlaceholders();
+                        consumer(*this->instantiatedModel, blockStart + lane);
+                    }
+                }
+            }
+        
+            template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+            template<typename CT>
+            typename std::enable_if<!std::is_same<CT, double>::value>::type
+            ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiateBatchInternal(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations, std::function<void(ConstantSparseModelType const&, uint64_t)> const& consumer) {
+                // Exact values are obtained by evaluating the functions one by one.
+                for (uint64_t index = 0; index < valuations.size(); ++index) {
+                    consumer(instantiate(valuations[index]), index);
+                }
             }
         
         template<typename ParametricSparseModelType, typename ConstantSparseModelType>
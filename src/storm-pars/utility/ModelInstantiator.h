@@ -3,9 +3,11 @@
 
 #include <unordered_map>
 #include <memory>
+#include <functional>
 #include <type_traits>
 
 #include "storm-pars/utility/parametric.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -48,11 +50,35 @@ namespace storm {
                  */
                 ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
                 
+                /*!
+                 * Instantiates the model for each of the given valuations (one after another) and passes each instantiated model to the given consumer.
+                 * All instances are written to the same model object, so a consumer can keep data (e.g., solvers) that refers to it between the calls.
+                 * For floating point models, the occurring functions are compiled once and evaluated for whole blocks of valuations.
+                 * The resulting values might then differ from the ones of instantiate in the last digits.
+                 *
+                 * @param valuations The valuations to consider.
+                 * @param consumer Called with the instantiated model and the index of the corresponding valuation.
+                 */
+                void instantiateBatch(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations, std::function<void(ConstantSparseModelType const&, uint64_t)> const& consumer);
+                
                 /*!
                  *  Check validity
                  */
                 void checkValid() const;
             private:
+                /*!
+                 * Writes the current values of the placeholders to the matrices and vectors according to the stored mappings.
+                 */
+                void applyPlaceholders();
+                
+                template<typename CT = ConstantType>
+                typename std::enable_if<std::is_same<CT, double>::value>::type
+                instantiateBatchInternal(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations, std::function<void(ConstantSparseModelType const&, uint64_t)> const& consumer);
+                
+                template<typename CT = ConstantType>
+                typename std::enable_if<!std::is_same<CT, double>::value>::type
+                instantiateBatchInternal(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations, std::function<void(ConstantSparseModelType const&, uint64_t)> const& consumer);
+                
                 /*!
                  * Initializes the instantiatedModel with dummy data by considering the model-specific ingredients.
                  * Also initializes other model-specific data, e.g., the exitRate vector of a markov automaton
@@ -167,6 +193,9 @@ namespace storm {
                 std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping; 
                 /// Connection of Vector entries with placeholders
                 std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping; 
+                /// The occurring functions compiled for batch instantiation (if already needed) together with the corresponding placeholders
+                std::unique_ptr<storm::utility::parametric::CompiledRationalFunctions> compiledFunctions;
+                std::vector<ConstantType*> compiledFunctionPlaceholders;
                 
                 
             };
@@ -45,7 +45,95 @@ namespace storm {
                 }
                 return true;
             }
+            
+            template<>
+            Monotonicity checkMonotonicity<storm::RationalFunction>(storm::RationalFunction const& function, typename VariableType<storm::RationalFunction>::type const& variable) {
+                // For f = n/d, the sign of the derivative is the sign of n'd - nd' as the squared denominator is positive.
+                storm::RawPolynomial numerator = function.nominatorAsPolynomial().coefficient() * function.nominatorAsPolynomial().polynomial();
+                storm::RawPolynomial denominator = function.denominatorAsPolynomial().coefficient() * function.denominatorAsPolynomial().polynomial();
+                storm::RawPolynomial derivativeNumerator = numerator.derivative(variable) * denominator - numerator * denominator.derivative(variable);
+                if (derivativeNumerator.isZero()) {
+                    return Monotonicity::Constant;
+                }
+                
+                // For nonnegative variables, every monomial is nonnegative. Hence, if all coefficients have the same
+                // sign, the derivative has this sign as well.
+                bool allNonNegative = true;
+                bool allNonPositive = true;
+                for (auto const& term : derivativeNumerator) {
+                    if (term.coeff() < storm::utility::zero<storm::RationalFunctionCoefficient>()) {
+                        allNonNegative = false;
+                    } else if (term.coeff() > storm::utility::zero<storm::RationalFunctionCoefficient>()) {
+                        allNonPositive = false;
+                    }
+                }
+                if (allNonNegative) {
+                    return Monotonicity::Increasing;
+                } else if (allNonPositive) {
+                    return Monotonicity::Decreasing;
+                }
+                return Monotonicity::Unknown;
+            }
+#endif
+            
+            template<typename FunctionType>
+            std::vector<Valuation<FunctionType>> getValuationsOfCartesianProduct(std::map<typename VariableType<FunctionType>::type, std::vector<typename CoefficientType<FunctionType>::type>> const& cartesianProduct) {
+                std::vector<Valuation<FunctionType>> result;
+                if (cartesianProduct.empty()) {
+                    return result;
+                }
+                
+                std::vector<typename VariableType<FunctionType>::type> parameters;
+                std::vector<uint64_t> indices;
+                std::vector<bool> ascending;
+                for (auto const& entry : cartesianProduct) {
+                    STORM_LOG_THROW(!entry.second.empty(), storm::exceptions::IllegalArgumentException, "Expected at least one value for parameter " << entry.first << ".");
+                    parameters.push_back(entry.first);
+                    indices.push_back(0);
+                    ascending.push_back(true);
+                }
+                
+                Valuation<FunctionType> valuation;
+                bool done = false;
+                while (!done) {
+                    // Read off valuation.
+                    for (uint64_t i = 0; i < parameters.size(); ++i) {
+                        valuation[parameters[i]] = cartesianProduct.at(parameters[i])[indices[i]];
+                    }
+                    result.push_back(valuation);
+                    
+                    done = true;
+                    for (uint64_t i = 0; i < parameters.size(); ++i) {
+                        if (ascending[i] && indices[i] + 1 < cartesianProduct.at(parameters[i]).size()) {
+                            ++indices[i];
+                        } else if (!ascending[i] && indices[i] > 0) {
+                            --indices[i];
+                        } else {
+                            // The parameter reached the end of its values, so it is traversed in the opposite
+                            // direction the next time and we proceed to move the next parameter.
+                            ascending[i] = !ascending[i];
+                            continue;
+                        }
+                        // If a parameter was moved, we have another valuation.
+                        done = false;
+                        break;
+                    }
+                }
+                return result;
+            }
+            
+#ifdef STORM_HAVE_CARL
+            template std::vector<Valuation<storm::RationalFunction>> getValuationsOfCartesianProduct<storm::RationalFunction>(std::map<typename VariableType<storm::RationalFunction>::type, std::vector<typename CoefficientType<storm::RationalFunction>::type>> const& cartesianProduct);
 #endif
+            
+            Monotonicity combineMonotonicity(Monotonicity const& first, Monotonicity const& second) {
+                if (first == Monotonicity::Constant) {
+                    return second;
+                } else if (second == Monotonicity::Constant || first == second) {
+                    return first;
+                }
+                return Monotonicity::Unknown;
+            }
         }
     }
 }
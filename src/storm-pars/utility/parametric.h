@@ -4,6 +4,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include <map>
+#include <vector>
 
 namespace storm {
     namespace utility {
@@ -36,6 +37,14 @@ namespace storm {
             template<typename FunctionType>
             typename CoefficientType<FunctionType>::type evaluate(FunctionType const& function, Valuation<FunctionType> const& valuation);
             
+            /*!
+             * Enumerates all valuations of the given cartesian product of parameter values. The valuations are ordered in
+             * a reflected (snake-like) way, i.e., consecutive valuations only differ in the value of a single parameter,
+             * which moves to a neighboring value.
+             */
+            template<typename FunctionType>
+            std::vector<Valuation<FunctionType>> getValuationsOfCartesianProduct(std::map<typename VariableType<FunctionType>::type, std::vector<typename CoefficientType<FunctionType>::type>> const& cartesianProduct);
+            
             /*!
              *  Add all variables that occur in the given function to the the given set
              */
@@ -54,6 +63,25 @@ namespace storm {
             template<typename FunctionType>
             bool isMultiLinearPolynomial(FunctionType const& function);
             
+            /*!
+             * The ways in which a function can depend on a variable.
+             */
+            enum class Monotonicity { Constant, Increasing, Decreasing, Unknown };
+            
+            /*!
+             * Checks whether the function is monotone in the given variable whenever all variables are nonnegative.
+             * This is decided syntactically via the signs of the coefficients of the numerator of the derivative.
+             * Hence, the check is sound but not complete, i.e., Unknown might be returned for monotone functions.
+             */
+            template<typename FunctionType>
+            Monotonicity checkMonotonicity(FunctionType const& function, typename VariableType<FunctionType>::type const& variable);
+            
+            /*!
+             * Combines the monotonicity of two functions, i.e., returns how the sum of two functions with the given
+             * monotonicity depends on the variable (Unknown if the directions differ).
+             */
+            Monotonicity combineMonotonicity(Monotonicity const& first, Monotonicity const& second);
+            
         }
         
     }
@@ -5,6 +5,8 @@
 
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/BisimulationDecomposition.h"
+#include "storm/storage/dd/bisimulation/Partition.h"
+#include "storm/storage/bisimulation/BisimulationPartitionCache.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -12,13 +14,59 @@
 namespace storm {
     namespace api {
         
+        /*!
+         * A cache for the label-only partition of a sparse model (stored as a mapping from states to blocks).
+         */
+        template <typename ValueType>
+        using SparseBisimulationPartitionCache = storm::storage::BisimulationPartitionCache<storm::models::sparse::Model<ValueType>, std::vector<uint_fast64_t>>;
+        
+        /*!
+         * A cache for the label-only partition of a symbolic model.
+         */
+        template <storm::dd::DdType DdType, typename ValueType>
+        using SymbolicBisimulationPartitionCache = storm::storage::BisimulationPartitionCache<storm::models::symbolic::Model<DdType, ValueType>, storm::dd::bisimulation::Partition<DdType, ValueType>>;
+        
+        /*!
+         * Prepares the given options such that the decomposition starts from the label-only partition stored in the
+         * cache. If the cache does not hold the partition for the model and the respected atomic propositions, it is
+         * computed (without respecting rewards) and stored first. Note that this disables the measure-driven initial
+         * partition.
+         */
+        template <typename DecompositionType, typename ModelType>
+        void useCachedSparsePartition(std::shared_ptr<ModelType> const& model, typename DecompositionType::Options& options, SparseBisimulationPartitionCache<typename ModelType::ValueType>& partitionCache) {
+            std::set<std::string> atomicPropositions = options.respectedAtomicPropositions ? options.respectedAtomicPropositions.get() : model->getStateLabeling().getLabels();
+            
+            if (!partitionCache.lookup(model, options.getType(), atomicPropositions)) {
+                STORM_LOG_INFO("Computing label-only partition for later bisimulation queries.");
+                typename DecompositionType::Options labelOnlyOptions = options;
+                labelOnlyOptions.measureDrivenInitialPartition = false;
+                labelOnlyOptions.respectedAtomicPropositions = atomicPropositions;
+                labelOnlyOptions.setKeepRewards(false);
+                labelOnlyOptions.buildQuotient = false;
+                labelOnlyOptions.initialPartition = boost::none;
+                
+                DecompositionType labelOnlyDecomposition(*model, labelOnlyOptions);
+                labelOnlyDecomposition.computeBisimulationDecomposition();
+                partitionCache.setPartition(model, options.getType(), atomicPropositions, labelOnlyDecomposition.getStateToBlockMapping());
+            } else {
+                STORM_LOG_INFO("Reusing cached label-only partition.");
+            }
+            
+            options.measureDrivenInitialPartition = false;
+            options.respectedAtomicPropositions = atomicPropositions;
+            options.initialPartition = partitionCache.getPartition();
+        }
+        
         template <typename ModelType>
-        std::shared_ptr<ModelType> performDeterministicSparseBisimulationMinimization(std::shared_ptr<ModelType> model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type) {
+        std::shared_ptr<ModelType> performDeterministicSparseBisimulationMinimization(std::shared_ptr<ModelType> model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type, SparseBisimulationPartitionCache<typename ModelType::ValueType>* partitionCache = nullptr) {
             typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options options;
             if (!formulas.empty()) {
                 options = typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
             }
             options.setType(type);
+            if (partitionCache) {
+                useCachedSparsePartition<storm::storage::DeterministicModelBisimulationDecomposition<ModelType>>(model, options, *partitionCache);
+            }
             
             storm::storage::DeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
             bisimulationDecomposition.computeBisimulationDecomposition();
@@ -26,20 +74,29 @@ namespace storm {
         }
         
         template<typename ModelType>
-        std::shared_ptr<ModelType> performNondeterministicSparseBisimulationMinimization(std::shared_ptr<ModelType> model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type) {
+        std::shared_ptr<ModelType> performNondeterministicSparseBisimulationMinimization(std::shared_ptr<ModelType> model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type, SparseBisimulationPartitionCache<typename ModelType::ValueType>* partitionCache = nullptr) {
             typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options options;
             if (!formulas.empty()) {
                 options = typename storm::storage::NondeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
             }
             options.setType(type);
+            if (partitionCache) {
+                useCachedSparsePartition<storm::storage::NondeterministicModelBisimulationDecomposition<ModelType>>(model, options, *partitionCache);
+            }
             
             storm::storage::NondeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
             bisimulationDecomposition.computeBisimulationDecomposition();
             return bisimulationDecomposition.getQuotient();
         }
         
+        /*!
+         * Performs bisimulation minimization on the given sparse model such that the given formulas are preserved. If
+         * a partition cache is given, the partition respecting only the atomic propositions of the formulas is
+         * computed once and later calls for the same model and atomic propositions refine the cached partition (e.g.
+         * wrt. reward models) instead of starting from the initial partition.
+         */
         template <typename ValueType>
-        std::shared_ptr<storm::models::sparse::Model<ValueType>> performBisimulationMinimization(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong) {
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> performBisimulationMinimization(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong, SparseBisimulationPartitionCache<ValueType>* partitionCache = nullptr) {
             
             STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Dtmc) || model->isOfType(storm::models::ModelType::Ctmc) || model->isOfType(storm::models::ModelType::Mdp), storm::exceptions::NotSupportedException, "Bisimulation minimization is currently only available for DTMCs, CTMCs and MDPs.");
 
@@ -47,16 +104,16 @@ namespace storm {
             model->reduceToStateBasedRewards();
 
             if (model->isOfType(storm::models::ModelType::Dtmc)) {
-                return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Dtmc<ValueType>>(model->template as<storm::models::sparse::Dtmc<ValueType>>(), formulas, type);
+                return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Dtmc<ValueType>>(model->template as<storm::models::sparse::Dtmc<ValueType>>(), formulas, type, partitionCache);
             } else if (model->isOfType(storm::models::ModelType::Ctmc)) {
-                return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Ctmc<ValueType>>(model->template as<storm::models::sparse::Ctmc<ValueType>>(), formulas, type);
+                return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Ctmc<ValueType>>(model->template as<storm::models::sparse::Ctmc<ValueType>>(), formulas, type, partitionCache);
             } else {
-                return performNondeterministicSparseBisimulationMinimization<storm::models::sparse::Mdp<ValueType>>(model->template as<storm::models::sparse::Mdp<ValueType>>(), formulas, type);
+                return performNondeterministicSparseBisimulationMinimization<storm::models::sparse::Mdp<ValueType>>(model->template as<storm::models::sparse::Mdp<ValueType>>(), formulas, type, partitionCache);
             }
         }
         
         template <storm::dd::DdType DdType, typename ValueType, typename ExportValueType = ValueType>
-        typename std::enable_if<DdType == storm::dd::DdType::Sylvan || std::is_same<ValueType, double>::value, std::shared_ptr<storm::models::Model<ExportValueType>>>::type performBisimulationMinimization(std::shared_ptr<storm::models::symbolic::Model<DdType, ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType const& bisimulationType = storm::storage::BisimulationType::Strong, storm::dd::bisimulation::SignatureMode const& mode = storm::dd::bisimulation::SignatureMode::Eager) {
+        typename std::enable_if<DdType == storm::dd::DdType::Sylvan || std::is_same<ValueType, double>::value, std::shared_ptr<storm::models::Model<ExportValueType>>>::type performBisimulationMinimization(std::shared_ptr<storm::models::symbolic::Model<DdType, ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType const& bisimulationType = storm::storage::BisimulationType::Strong, storm::dd::bisimulation::SignatureMode const& mode = storm::dd::bisimulation::SignatureMode::Eager, SymbolicBisimulationPartitionCache<DdType, ValueType>* partitionCache = nullptr) {
             
             STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Dtmc) || model->isOfType(storm::models::ModelType::Ctmc) || model->isOfType(storm::models::ModelType::Mdp) || model->isOfType(storm::models::ModelType::MarkovAutomaton), storm::exceptions::NotSupportedException, "Symbolic bisimulation minimization is currently only available for DTMCs, CTMCs, MDPs and MAs.");
             STORM_LOG_THROW(bisimulationType == storm::storage::BisimulationType::Strong, storm::exceptions::NotSupportedException, "Currently only strong bisimulation is supported.");
@@ -64,13 +121,42 @@ namespace storm {
             // Try to get rid of non state-rewards to easy bisimulation computation.
             model->reduceToStateBasedRewards();
             
+            if (partitionCache) {
+                storm::dd::bisimulation::PreservationInformation<DdType, ValueType> preservationInformation(*model, formulas);
+                std::set<std::string> atomicPropositions = preservationInformation.getLabels();
+                for (auto const& expression : preservationInformation.getExpressions()) {
+                    atomicPropositions.insert(expression.toString());
+                }
+                
+                if (!partitionCache->lookup(model, bisimulationType, atomicPropositions)) {
+                    STORM_LOG_INFO("Computing label-only partition for later bisimulation queries.");
+                    storm::dd::bisimulation::PreservationInformation<DdType, ValueType> labelOnlyPreservationInformation;
+                    for (auto const& label : preservationInformation.getLabels()) {
+                        labelOnlyPreservationInformation.addLabel(label);
+                    }
+                    for (auto const& expression : preservationInformation.getExpressions()) {
+                        labelOnlyPreservationInformation.addExpression(expression);
+                    }
+                    
+                    storm::dd::BisimulationDecomposition<DdType, ValueType, ExportValueType> labelOnlyDecomposition(*model, bisimulationType, labelOnlyPreservationInformation);
+                    labelOnlyDecomposition.compute(mode);
+                    partitionCache->setPartition(model, bisimulationType, atomicPropositions, labelOnlyDecomposition.getStatePartition());
+                } else {
+                    STORM_LOG_INFO("Reusing cached label-only partition.");
+                }
+                
+                storm::dd::BisimulationDecomposition<DdType, ValueType, ExportValueType> decomposition(*model, partitionCache->getPartition(), preservationInformation);
+                decomposition.compute(mode);
+                return decomposition.getQuotient();
+            }
+            
             storm::dd::BisimulationDecomposition<DdType, ValueType, ExportValueType> decomposition(*model, formulas, bisimulationType);
             decomposition.compute(mode);
             return decomposition.getQuotient();
         }
         
         template <storm::dd::DdType DdType, typename ValueType, typename ExportValueType = ValueType>
-        typename std::enable_if<DdType != storm::dd::DdType::Sylvan && !std::is_same<ValueType, double>::value, std::shared_ptr<storm::models::Model<ExportValueType>>>::type performBisimulationMinimization(std::shared_ptr<storm::models::symbolic::Model<DdType, ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType const& bisimulationType = storm::storage::BisimulationType::Strong, storm::dd::bisimulation::SignatureMode const& mode = storm::dd::bisimulation::SignatureMode::Eager) {
+        typename std::enable_if<DdType != storm::dd::DdType::Sylvan && !std::is_same<ValueType, double>::value, std::shared_ptr<storm::models::Model<ExportValueType>>>::type performBisimulationMinimization(std::shared_ptr<storm::models::symbolic::Model<DdType, ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType const& bisimulationType = storm::storage::BisimulationType::Strong, storm::dd::bisimulation::SignatureMode const& mode = storm::dd::bisimulation::SignatureMode::Eager, SymbolicBisimulationPartitionCache<DdType, ValueType>* partitionCache = nullptr) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Symbolic bisimulation minimization is not supported for this combination of DD library and value type.");
             return nullptr;
         }
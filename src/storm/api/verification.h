@@ -2,6 +2,8 @@
 
 #include <type_traits>
 
+#include "storm/environment/Environment.h"
+
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
@@ -154,6 +156,19 @@ namespace storm {
             return result;
         }
         
+        /*!
+         * Computes the probabilities of the given (time-bounded) reachability property on the CTMC for the time interval
+         * [0, t] for each of the given time bounds t. The time bound of the property (if any) is ignored and all time
+         * bounds are treated in a single uniformization sweep.
+         *
+         * @return For each of the time bounds (in the given order), the result of the check.
+         */
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::vector<double> const& timeBounds) {
+            storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+            return modelchecker.computeBoundedUntilProbabilities(storm::Environment(), task, timeBounds);
+        }
+        
         template<typename ValueType>
         typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -20,6 +20,7 @@ namespace storm {
         if (multiobjectiveSettings.isMaxStepsSet()) {
             maxSteps = multiobjectiveSettings.getMaxSteps();
         }
+        refinementBatchSize = multiobjectiveSettings.getRefinementBatchSize();
     }
     
     MultiObjectiveModelCheckerEnvironment::~MultiObjectiveModelCheckerEnvironment() {
@@ -97,4 +98,13 @@ namespace storm {
     void MultiObjectiveModelCheckerEnvironment::unsetMaxSteps() {
         maxSteps = boost::none;
     }
+    
+    uint64_t const& MultiObjectiveModelCheckerEnvironment::getRefinementBatchSize() const {
+        return refinementBatchSize;
+    }
+    
+    void MultiObjectiveModelCheckerEnvironment::setRefinementBatchSize(uint64_t const& value) {
+        STORM_LOG_ASSERT(value > 0, "The refinement batch size must be positive.");
+        refinementBatchSize = value;
+    }
 }
\ No newline at end of file
@@ -36,12 +36,16 @@ namespace storm {
         void setMaxSteps(uint64_t const& value);
         void unsetMaxSteps();
         
+        uint64_t const& getRefinementBatchSize() const;
+        void setRefinementBatchSize(uint64_t const& value);
+        
         
     private:
         storm::modelchecker::multiobjective::MultiObjectiveMethod method;
         boost::optional<std::string> plotPathUnderApprox, plotPathOverApprox, plotPathParetoPoints;
         storm::RationalNumber precision;
         boost::optional<uint64_t> maxSteps;
+        uint64_t refinementBatchSize;
         
     };
 }
@@ -71,6 +71,34 @@ namespace storm {
             return std::unique_ptr<CheckResult>(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
         }
         
+        template <typename SparseCtmcModelType>
+        std::vector<std::unique_ptr<CheckResult>> SparseCtmcCslModelChecker<SparseCtmcModelType>::computeBoundedUntilProbabilities(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask, std::vector<double> const& upperBounds) {
+            storm::logic::Formula const& pathFormula = checkTask.getFormula().isProbabilityOperatorFormula() ? checkTask.getFormula().asProbabilityOperatorFormula().getSubformula() : checkTask.getFormula();
+            
+            storm::storage::BitVector phiStates;
+            storm::storage::BitVector psiStates;
+            if (pathFormula.isEventuallyFormula()) {
+                phiStates = storm::storage::BitVector(this->getModel().getNumberOfStates(), true);
+                psiStates = this->check(env, pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            } else if (pathFormula.isUntilFormula()) {
+                phiStates = this->check(env, pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                psiStates = this->check(env, pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            } else {
+                STORM_LOG_THROW(pathFormula.isBoundedUntilFormula(), storm::exceptions::InvalidPropertyException, "Expected a reachability formula, but got " << pathFormula << ".");
+                storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula.asBoundedUntilFormula();
+                STORM_LOG_THROW(!boundedUntilFormula.isMultiDimensional() && boundedUntilFormula.getTimeBoundReference().isTimeBound() && !boundedUntilFormula.hasLowerBound(), storm::exceptions::NotImplementedException, "Only upper time bounds can be replaced by several time bounds.");
+                phiStates = this->check(env, boundedUntilFormula.getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                psiStates = this->check(env, boundedUntilFormula.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            }
+            
+            std::vector<std::vector<ValueType>> numericResults = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(env, this->getModel().getTransitionMatrix(), this->getModel().getBackwardTransitions(), phiStates, psiStates, this->getModel().getExitRateVector(), upperBounds);
+            std::vector<std::unique_ptr<CheckResult>> results;
+            for (auto& numericResult : numericResults) {
+                results.emplace_back(new ExplicitQuantitativeCheckResult<ValueType>(std::move(numericResult)));
+            }
+            return results;
+        }
+        
         template <typename SparseCtmcModelType>
         std::unique_ptr<CheckResult> SparseCtmcCslModelChecker<SparseCtmcModelType>::computeNextProbabilities(Environment const& env, CheckTask<storm::logic::NextFormula, ValueType> const& checkTask) {
             storm::logic::NextFormula const& pathFormula = checkTask.getFormula();
@@ -35,6 +35,15 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> computeReachabilityRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeTotalRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::TotalRewardFormula, ValueType> const& checkTask) override;
 
+            /*!
+             * Computes the probabilities of the given reachability formula (P=? [phi U psi], P=? [F psi] or an upper
+             * time-bounded variant thereof) for the time interval [0, t] for each of the given upper time bounds t. The
+             * time bound of the formula (if any) is ignored. All time bounds are treated in a single uniformization sweep.
+             *
+             * @return For each of the upper time bounds (in the given order), the result of the check.
+             */
+            std::vector<std::unique_ptr<CheckResult>> computeBoundedUntilProbabilities(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask, std::vector<double> const& upperBounds);
+
         private:
             template<typename CValueType = ValueType, typename std::enable_if<storm::NumberTraits<CValueType>::SupportsExponential, int>::type = 0>
             bool canHandleImplementation(CheckTask<storm::logic::Formula, CValueType> const& checkTask) const;
@@ -1,5 +1,10 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 
@@ -7,6 +12,8 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/Multiplier.h"
@@ -201,6 +208,59 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
             }
 
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds) {
+                for (auto const& upperBound : upperBounds) {
+                    STORM_LOG_THROW(upperBound >= 0 && upperBound != storm::utility::infinity<double>(), storm::exceptions::InvalidPropertyException, "Expected finite, non-negative time bounds, but got " << upperBound << ".");
+                }
+                
+                uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+                
+                // All states that do not reach a psi state (via phi states) have probability zero for every time bound
+                // and the psi states have probability one.
+                std::vector<ValueType> initialResult(numberOfStates, storm::utility::zero<ValueType>());
+                storm::utility::vector::setVectorValues<ValueType>(initialResult, psiStates, storm::utility::one<ValueType>());
+                std::vector<std::vector<ValueType>> result(upperBounds.size(), initialResult);
+                
+                storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+                storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+                STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+                if (statesWithProbabilityGreater0NonPsi.empty()) {
+                    return result;
+                }
+                
+                // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+                ValueType uniformizationRate = 0;
+                for (auto const& state : statesWithProbabilityGreater0NonPsi) {
+                    uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+                }
+                uniformizationRate *= 1.02;
+                STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+                
+                // Compute the uniformized matrix and the vector that is to be added as a compensation for removing the
+                // absorbing states.
+                storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+                std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+                for (auto& element : b) {
+                    element /= uniformizationRate;
+                }
+                
+                // Compute the transient probabilities for all time bounds in one sweep.
+                std::vector<ValueType> timeBounds(upperBounds.begin(), upperBounds.end());
+                std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                std::vector<std::vector<ValueType>> subresults = computeTransientProbabilities(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, values);
+                for (uint64_t index = 0; index < upperBounds.size(); ++index) {
+                    storm::utility::vector::setVectorValues(result[index], statesWithProbabilityGreater0NonPsi, subresults[index]);
+                }
+                
+                return result;
+            }
+            
+            template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&, storm::storage::BitVector const&, std::vector<ValueType> const&, std::vector<double> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
+            }
+
             template <typename ValueType>
             std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative) {
                 return SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(env, std::move(goal), computeProbabilityMatrix(rateMatrix, exitRateVector), backwardTransitions, phiStates, psiStates, qualitative);
@@ -405,6 +465,159 @@ namespace storm {
                                                          exitRateVector);
             }
             
+            /*!
+             * Retrieves the maximal number of states of a BSCC for which the steady state distribution is computed on a
+             * dense representation of the BSCC. For exact value types, this is considerably smaller, because the cost of
+             * the arithmetic operations grows with the size of the numbers.
+             */
+            template <typename ValueType>
+            uint_fast64_t getMaximalNumberOfStatesForDenseSteadyStateComputation() {
+                return storm::NumberTraits<ValueType>::IsExact ? 16 : 128;
+            }
+            
+            /*!
+             * Computes the steady state distribution of the given BSCC with the GTH algorithm (Grassmann, Taksar and
+             * Heyman) on a dense representation of the transitions within the BSCC. As the algorithm is a variant of
+             * Gaussian elimination without subtractions, it is numerically stable and does not need any pivoting.
+             *
+             * @param probabilityMatrix The probability matrix of the model.
+             * @param bscc The BSCC. It must contain more than one state.
+             * @param steadyStateProbabilities The vector (indexed by the states of the model) in which to store the result.
+             */
+            template <typename ValueType>
+            void computeBsccSteadyStateDistributionDense(storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::StronglyConnectedComponent const& bscc, std::vector<ValueType>& steadyStateProbabilities) {
+                std::vector<uint_fast64_t> states(bscc.begin(), bscc.end());
+                uint_fast64_t n = states.size();
+                
+                // Build the dense matrix of the transitions within the BSCC.
+                std::vector<ValueType> p(n * n, storm::utility::zero<ValueType>());
+                for (uint_fast64_t row = 0; row < n; ++row) {
+                    for (auto const& entry : probabilityMatrix.getRow(states[row])) {
+                        auto columnIt = std::lower_bound(states.begin(), states.end(), entry.getColumn());
+                        if (columnIt == states.end() || *columnIt != entry.getColumn()) {
+                            STORM_LOG_ASSERT(storm::utility::isZero(entry.getValue()), "BSCC is not closed.");
+                            continue;
+                        }
+                        p[row * n + std::distance(states.begin(), columnIt)] += entry.getValue();
+                    }
+                }
+                
+                // Eliminate the states one by one, starting with the last one.
+                for (uint_fast64_t l = n - 1; l > 0; --l) {
+                    ValueType exitProbability = storm::utility::zero<ValueType>();
+                    for (uint_fast64_t j = 0; j < l; ++j) {
+                        exitProbability += p[l * n + j];
+                    }
+                    for (uint_fast64_t i = 0; i < l; ++i) {
+                        p[i * n + l] /= exitProbability;
+                    }
+                    for (uint_fast64_t i = 0; i < l; ++i) {
+                        ValueType const& factor = p[i * n + l];
+                        if (storm::utility::isZero(factor)) {
+                            continue;
+                        }
+                        for (uint_fast64_t j = 0; j < l; ++j) {
+                            p[i * n + j] += factor * p[l * n + j];
+                        }
+                    }
+                }
+                
+                // Perform the back substitution and normalize the result.
+                std::vector<ValueType> distribution(n, storm::utility::zero<ValueType>());
+                distribution[0] = storm::utility::one<ValueType>();
+                ValueType total = storm::utility::one<ValueType>();
+                for (uint_fast64_t j = 1; j < n; ++j) {
+                    for (uint_fast64_t i = 0; i < j; ++i) {
+                        distribution[j] += distribution[i] * p[i * n + j];
+                    }
+                    total += distribution[j];
+                }
+                for (uint_fast64_t i = 0; i < n; ++i) {
+                    steadyStateProbabilities[states[i]] = distribution[i] / total;
+                }
+            }
+            
+            /*!
+             * Computes the steady state distribution of the given BSCC by solving the corresponding equation system with
+             * the configured linear equation solver.
+             *
+             * @param env The environment that determines the linear equation solver.
+             * @param probabilityMatrix The probability matrix of the model.
+             * @param bscc The BSCC.
+             * @param steadyStateProbabilities The vector (indexed by the states of the model) in which to store the result.
+             */
+            template <typename ValueType>
+            void computeBsccSteadyStateDistributionWithSolver(Environment const& env, storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::StronglyConnectedComponent const& bscc, std::vector<ValueType>& steadyStateProbabilities) {
+                ValueType one = storm::utility::one<ValueType>();
+                ValueType zero = storm::utility::zero<ValueType>();
+                
+                storm::storage::BitVector bsccStates(probabilityMatrix.getRowCount());
+                for (auto const& state : bscc) {
+                    bsccStates.set(state);
+                }
+                
+                // Since in the fix point equation, we need to multiply the vector from the left, we convert this to a
+                // multiplication from the right by transposing the system.
+                storm::storage::SparseMatrix<ValueType> bsccEquationSystem = probabilityMatrix.getSubmatrix(false, bsccStates, bsccStates, true).transpose(false, true);
+                
+                // Build a different system depending on the problem format of the equation solver.
+                // Check solver requirements.
+                storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+                auto requirements = linearEquationSolverFactory.getRequirements(env);
+                requirements.clearLowerBounds();
+                requirements.clearUpperBounds();
+                STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + requirements.getEnabledRequirementsAsString() + " not checked.");
+                
+                bool fixedPointSystem = false;
+                if (linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::FixedPointSystem) {
+                    fixedPointSystem = true;
+                }
+                
+                // Now build the final equation system matrix and the right-hand side in one go.
+                uint_fast64_t numberOfBsccStates = bsccEquationSystem.getRowCount();
+                std::vector<ValueType> bsccEquationSystemRightSide(numberOfBsccStates, zero);
+                storm::storage::SparseMatrixBuilder<ValueType> builder;
+                for (uint_fast64_t row = 0; row < numberOfBsccStates; ++row) {
+                    // We substitute the first row by the constraint that the values for states of the BSCC must sum to
+                    // one. However, in order to have a non-zero value on the diagonal, we add the constraint of the BSCC
+                    // that produces a 1 on the diagonal.
+                    if (row == 0) {
+                        for (uint_fast64_t column = 0; column < numberOfBsccStates; ++column) {
+                            if (!fixedPointSystem) {
+                                builder.addNextValue(row, column, one);
+                            } else if (column == row) {
+                                builder.addNextValue(row, column, zero);
+                            } else {
+                                builder.addNextValue(row, column, -one);
+                            }
+                        }
+                        bsccEquationSystemRightSide[row] = one;
+                    } else {
+                        // Otherwise, we copy the row, and subtract 1 from the diagonal (only for the equation solver format).
+                        for (auto& entry : bsccEquationSystem.getRow(row)) {
+                            if (fixedPointSystem || entry.getColumn() != row) {
+                                builder.addNextValue(row, entry.getColumn(), entry.getValue());
+                            } else {
+                                builder.addNextValue(row, entry.getColumn(), entry.getValue() - one);
+                            }
+                        }
+                    }
+                }
+                
+                // Create the initial guess. We take a uniform distribution over all states in the BSCC.
+                std::vector<ValueType> bsccEquationSystemSolution(numberOfBsccStates, one / bscc.size());
+                
+                bsccEquationSystem = builder.build();
+                {
+                    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(bsccEquationSystem));
+                    solver->setLowerBound(zero);
+                    solver->setUpperBound(one);
+                    solver->solveEquations(env, bsccEquationSystemSolution, bsccEquationSystemRightSide);
+                }
+                
+                storm::utility::vector::setVectorValues(steadyStateProbabilities, bsccStates, bsccEquationSystemSolution);
+            }
+            
             template <typename ValueType>
             std::vector<ValueType> SparseCtmcCslHelper::computeLongRunAverages(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, std::function<ValueType (storm::storage::sparse::state_type const& state)> const& valueGetter, std::vector<ValueType> const* exitRateVector){
                 uint_fast64_t numberOfStates = probabilityMatrix.getRowCount();
@@ -418,172 +631,83 @@ namespace storm {
                 ValueType one = storm::utility::one<ValueType>();
                 ValueType zero = storm::utility::zero<ValueType>();
                 
-                // Prepare the vector holding the LRA values for each of the BSCCs.
-                std::vector<ValueType> bsccLra(bsccDecomposition.size(), zero);
-                
-                // First we check which states are in BSCCs.
+                // First we check which states are in BSCCs and sort the BSCCs by the way their steady state distribution is
+                // computed: trivially (for BSCCs with one state), on a dense representation (for small BSCCs) or with
+                // the configured linear equation solver (for large BSCCs).
                 storm::storage::BitVector statesInBsccs(numberOfStates);
-                storm::storage::BitVector firstStatesInBsccs(numberOfStates);
-                
+                std::vector<uint_fast64_t> stateToBsccIndexMap(numberOfStates);
+                std::vector<uint_fast64_t> denseBsccs;
+                std::vector<uint_fast64_t> largeBsccs;
+                uint_fast64_t maximalNumberOfStatesForDenseComputation = getMaximalNumberOfStatesForDenseSteadyStateComputation<ValueType>();
                 for (uint_fast64_t currentBsccIndex = 0; currentBsccIndex < bsccDecomposition.size(); ++currentBsccIndex) {
                     storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[currentBsccIndex];
-                    
-                    // Gather information for later use.
-                    bool first = true;
                     for (auto const& state : bscc) {
                         statesInBsccs.set(state);
-                        if (first) {
-                            firstStatesInBsccs.set(state);
-                        }
-                        first = false;
+                        stateToBsccIndexMap[state] = currentBsccIndex;
+                    }
+                    
+                    if (bscc.size() > maximalNumberOfStatesForDenseComputation) {
+                        largeBsccs.push_back(currentBsccIndex);
+                    } else if (bscc.size() > 1) {
+                        denseBsccs.push_back(currentBsccIndex);
                     }
                 }
                 storm::storage::BitVector statesNotInBsccs = ~statesInBsccs;
                 
                 STORM_LOG_DEBUG("Found " << statesInBsccs.getNumberOfSetBits() << " states in BSCCs.");
+                STORM_LOG_DEBUG("Computing steady state distributions of " << (bsccDecomposition.size() - denseBsccs.size() - largeBsccs.size()) << " trivial, " << denseBsccs.size() << " small and " << largeBsccs.size() << " large BSCCs.");
                 
-                // Prepare a vector holding the index within all states that are in BSCCs for every state.
-                std::vector<uint_fast64_t> indexInStatesInBsccs;
+                // The steady state distributions within the BSCCs. The (only) state of a trivial BSCC has probability one.
+                std::vector<ValueType> steadyStateProbabilities(numberOfStates, one);
                 
-                // Prepare a vector that maps the index within the set of all states in BSCCs to the index of the containing BSCC.
-                std::vector<uint_fast64_t> stateToBsccIndexMap;
-                
-                if (!statesInBsccs.empty()) {
-                    firstStatesInBsccs = firstStatesInBsccs % statesInBsccs;
-                    
-                    // Then we construct an equation system that yields the steady state probabilities for all states in BSCCs.
-                    storm::storage::SparseMatrix<ValueType> bsccEquationSystem = probabilityMatrix.getSubmatrix(false, statesInBsccs, statesInBsccs, true);
-                    
-                    // Since in the fix point equation, we need to multiply the vector from the left, we convert this to a
-                    // multiplication from the right by transposing the system.
-                    bsccEquationSystem = bsccEquationSystem.transpose(false, true);
-                    
-                    // Create an auxiliary structure that makes it easy to look up the indices within the set of BSCC states.
-                    uint_fast64_t lastIndex = 0;
-                    uint_fast64_t currentNumberOfSetBits = 0;
-                    indexInStatesInBsccs.reserve(probabilityMatrix.getRowCount());
-                    for (auto index : statesInBsccs) {
-                        while (lastIndex <= index) {
-                            indexInStatesInBsccs.push_back(currentNumberOfSetBits);
-                            ++lastIndex;
+                // The small BSCCs are independent of each other, so we can process them in parallel.
+#ifdef STORM_HAVE_INTELTBB
+                if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                    tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, denseBsccs.size()), [&] (tbb::blocked_range<uint_fast64_t> const& range) {
+                        for (uint_fast64_t index = range.begin(); index < range.end(); ++index) {
+                            computeBsccSteadyStateDistributionDense(probabilityMatrix, bsccDecomposition[denseBsccs[index]], steadyStateProbabilities);
                         }
-                        ++currentNumberOfSetBits;
-                    }
-                    
-                    stateToBsccIndexMap.resize(statesInBsccs.getNumberOfSetBits());
-                    for (uint_fast64_t currentBsccIndex = 0; currentBsccIndex < bsccDecomposition.size(); ++currentBsccIndex) {
-                        storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[currentBsccIndex];
-                        for (auto const& state : bscc) {
-                            stateToBsccIndexMap[indexInStatesInBsccs[state]] = currentBsccIndex;
-                        }
-                    }
-                    
-                    // Build a different system depending on the problem format of the equation solver.
-                    // Check solver requirements.
-                    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
-                    auto requirements = linearEquationSolverFactory.getRequirements(env);
-                    requirements.clearLowerBounds();
-                    requirements.clearUpperBounds();
-                    STORM_LOG_THROW(!requirements.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + requirements.getEnabledRequirementsAsString() + " not checked.");
-                    
-                    bool fixedPointSystem = false;
-                    if (linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::FixedPointSystem) {
-                        fixedPointSystem = true;
+                    });
+                } else {
+                    for (auto const& bsccIndex : denseBsccs) {
+                        computeBsccSteadyStateDistributionDense(probabilityMatrix, bsccDecomposition[bsccIndex], steadyStateProbabilities);
                     }
-
-                    // Now build the final equation system matrix, the initial guess and the right-hand side in one go.
-                    std::vector<ValueType> bsccEquationSystemRightSide(bsccEquationSystem.getColumnCount(), zero);
-                    storm::storage::SparseMatrixBuilder<ValueType> builder;
-                    for (uint_fast64_t row = 0; row < bsccEquationSystem.getRowCount(); ++row) {
-                    
-                        // If the current row is the first one belonging to a BSCC, we substitute it by the constraint that the
-                        // values for states of this BSCC must sum to one. However, in order to have a non-zero value on the
-                        // diagonal, we add the constraint of the BSCC that produces a 1 on the diagonal.
-                        if (firstStatesInBsccs.get(row)) {
-                            uint_fast64_t requiredBscc = stateToBsccIndexMap[row];
-                            storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[requiredBscc];
-
-                            if (fixedPointSystem) {
-                                for (auto const& state : bscc) {
-                                    if (row == indexInStatesInBsccs[state]) {
-                                        builder.addNextValue(row, indexInStatesInBsccs[state], zero);
-                                    } else {
-                                        builder.addNextValue(row, indexInStatesInBsccs[state], -one);
-                                    }
-                                }
-                            } else {
-                                for (auto const& state : bscc) {
-                                    builder.addNextValue(row, indexInStatesInBsccs[state], one);
-                                }
+                }
+#else
+                for (auto const& bsccIndex : denseBsccs) {
+                    computeBsccSteadyStateDistributionDense(probabilityMatrix, bsccDecomposition[bsccIndex], steadyStateProbabilities);
+                }
+#endif
+                
+                for (auto const& bsccIndex : largeBsccs) {
+                    computeBsccSteadyStateDistributionWithSolver(env, probabilityMatrix, bsccDecomposition[bsccIndex], steadyStateProbabilities);
+                }
+                
+                // If exit rates were given, we need to 'fix' the results to also account for the timing behaviour. This
+                // does not affect trivial BSCCs.
+                if (exitRateVector != nullptr) {
+                    std::vector<ValueType> bsccTotalValue(bsccDecomposition.size(), zero);
+                    for (auto const& bsccIndices : {&denseBsccs, &largeBsccs}) {
+                        for (auto const& bsccIndex : *bsccIndices) {
+                            for (auto const& state : bsccDecomposition[bsccIndex]) {
+                                steadyStateProbabilities[state] /= (*exitRateVector)[state];
+                                bsccTotalValue[bsccIndex] += steadyStateProbabilities[state];
                             }
-                            
-                            bsccEquationSystemRightSide[row] = one;
-                        } else {
-                            // Otherwise, we copy the row, and subtract 1 from the diagonal (only for the equation solver format).
-                            for (auto& entry : bsccEquationSystem.getRow(row)) {
-                                if (fixedPointSystem || entry.getColumn() != row) {
-                                    builder.addNextValue(row, entry.getColumn(), entry.getValue());
-                                } else {
-                                    builder.addNextValue(row, entry.getColumn(), entry.getValue() - one);
-                                }
+                            for (auto const& state : bsccDecomposition[bsccIndex]) {
+                                steadyStateProbabilities[state] /= bsccTotalValue[bsccIndex];
                             }
                         }
                     }
-                    
-                    // Create the initial guess for the LRAs. We take a uniform distribution over all states in a BSCC.
-                    std::vector<ValueType> bsccEquationSystemSolution(bsccEquationSystem.getColumnCount(), zero);
-                    for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
-                        storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[bsccIndex];
-                        
-                        for (auto const& state : bscc) {
-                            bsccEquationSystemSolution[indexInStatesInBsccs[state]] = one / bscc.size();
-                        }
-                    }
-                    
-                    bsccEquationSystem = builder.build();
-                    {
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(bsccEquationSystem));
-                        solver->setLowerBound(storm::utility::zero<ValueType>());
-                        solver->setUpperBound(storm::utility::one<ValueType>());
-                        solver->solveEquations(env, bsccEquationSystemSolution, bsccEquationSystemRightSide);
-                    }
-                    
-                    // If exit rates were given, we need to 'fix' the results to also account for the timing behaviour.
-                    if (exitRateVector != nullptr) {
-                        std::vector<ValueType> bsccTotalValue(bsccDecomposition.size(), zero);
-                        for (auto stateIter = statesInBsccs.begin(); stateIter != statesInBsccs.end(); ++stateIter) {
-                            bsccTotalValue[stateToBsccIndexMap[indexInStatesInBsccs[*stateIter]]] += bsccEquationSystemSolution[indexInStatesInBsccs[*stateIter]] * (one / (*exitRateVector)[*stateIter]);
-                        }
-                        
-                        for (auto stateIter = statesInBsccs.begin(); stateIter != statesInBsccs.end(); ++stateIter) {
-                            bsccEquationSystemSolution[indexInStatesInBsccs[*stateIter]] = (bsccEquationSystemSolution[indexInStatesInBsccs[*stateIter]] * (one / (*exitRateVector)[*stateIter])) / bsccTotalValue[stateToBsccIndexMap[indexInStatesInBsccs[*stateIter]]];
-                        }
-                    }
-                                        
-                    // Calculate LRA Value for each BSCC from steady state distribution in BSCCs.
-                    for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
-                        storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[bsccIndex];
-                        
-                        for (auto const& state : bscc) {
-                            bsccLra[stateToBsccIndexMap[indexInStatesInBsccs[state]]] += valueGetter(state) * bsccEquationSystemSolution[indexInStatesInBsccs[state]];
-                        }
-                    }
-                    
-                    for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
-                        STORM_LOG_DEBUG("Found LRA " << bsccLra[bsccIndex] << " for BSCC " << bsccIndex << ".");
-                    }
-                } else {
-                    for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
-                        storm::storage::StronglyConnectedComponent const& bscc = bsccDecomposition[bsccIndex];
-                        
-                        // At this point, all BSCCs are known to contain exactly one state, which is why we can set all values
-                        // directly (based on whether or not the contained state is a psi state).
-                        bsccLra[bsccIndex] = valueGetter(*bscc.begin());
-                    }
-                    
-                    for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
-                        STORM_LOG_DEBUG("Found LRA " << bsccLra[bsccIndex] << " for BSCC " << bsccIndex << ".");
-                    }
+                }
+                
+                // Calculate LRA Value for each BSCC from steady state distribution in BSCCs.
+                std::vector<ValueType> bsccLra(bsccDecomposition.size(), zero);
+                for (auto state : statesInBsccs) {
+                    bsccLra[stateToBsccIndexMap[state]] += valueGetter(state) * steadyStateProbabilities[state];
+                }
+                
+                for (uint_fast64_t bsccIndex = 0; bsccIndex < bsccDecomposition.size(); ++bsccIndex) {
+                    STORM_LOG_DEBUG("Found LRA " << bsccLra[bsccIndex] << " for BSCC " << bsccIndex << ".");
                 }
                 
                 std::vector<ValueType> rewardSolution;
@@ -600,7 +724,7 @@ namespace storm {
                         ValueType reward = zero;
                         for (auto entry : probabilityMatrix.getRow(state)) {
                             if (statesInBsccs.get(entry.getColumn())) {
-                                reward += entry.getValue() * bsccLra[stateToBsccIndexMap[indexInStatesInBsccs[entry.getColumn()]]];
+                                reward += entry.getValue() * bsccLra[stateToBsccIndexMap[entry.getColumn()]];
                             }
                         }
                         rewardRightSide.push_back(reward);
@@ -685,7 +809,8 @@ namespace storm {
                 // Use Fox-Glynn to get the truncation points and the weights.
 //                std::tuple<uint_fast64_t, uint_fast64_t, ValueType, std::vector<ValueType>> foxGlynnResult = storm::utility::numerical::getFoxGlynnCutoff(lambda, 1e+300, storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0);
                 
-                storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0);
+                ValueType epsilon = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0;
+                storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
                 STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
                 
                 // Scale the weights so they add up to one.
@@ -722,17 +847,46 @@ namespace storm {
                     }
                 }
                 
+                // Computes the weight with which the values of all iterations after the given one contribute to the result.
+                // Once the values do not change any more, i.e. the steady state is reached, this weight is used to account
+                // for all remaining iterations at once.
+                auto getRemainingWeight = [&] (uint_fast64_t iteration) {
+                    ValueType remainingWeight = storm::utility::zero<ValueType>();
+                    if (useMixedPoissonProbabilities && iteration + 1 < startingIteration) {
+                        remainingWeight += storm::utility::convertNumber<ValueType>(startingIteration - iteration - 1) / uniformizationRate;
+                    }
+                    for (uint_fast64_t index = std::max(iteration + 1, startingIteration); index <= foxGlynnResult.right; ++index) {
+                        remainingWeight += foxGlynnResult.weights[index - foxGlynnResult.left];
+                    }
+                    return remainingWeight;
+                };
+                
                 auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
-                if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
-                    // Perform the matrix-vector multiplications (without adding).
-                    multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
-                } else if (useMixedPoissonProbabilities) {
-                    std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate] (ValueType const& a, ValueType const& b) { return a + b / uniformizationRate; };
-                    
-                    // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
-                    for (uint_fast64_t index = 1; index < startingIteration; ++index) {
-                        multiplier->multiply(env, values, nullptr, values);
-                        storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+                bool detectSteadyState = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isSteadyStateDetectionSet();
+                std::vector<ValueType> nextValues(values.size());
+                
+                // Performs one matrix-vector multiplication and retrieves whether the steady state is reached.
+                auto performIteration = [&] () {
+                    multiplier->multiply(env, values, addVector, nextValues);
+                    bool steadyStateReached = detectSteadyState && storm::utility::vector::equalModuloPrecision<ValueType>(values, nextValues, epsilon, false);
+                    std::swap(values, nextValues);
+                    return steadyStateReached;
+                };
+                
+                // For the iterations below the left truncation point, we only need to perform the matrix-vector
+                // multiplications (and add and scale the result with the uniformization rate for mixed poisson probabilities).
+                std::function<ValueType(ValueType const&, ValueType const&)> addAndScaleWithUniformizationRate = [&uniformizationRate] (ValueType const& a, ValueType const& b) { return a + b / uniformizationRate; };
+                for (uint_fast64_t index = 1; index < startingIteration; ++index) {
+                    bool steadyStateReached = performIteration();
+                    if (useMixedPoissonProbabilities) {
+                        storm::utility::vector::applyPointwise(result, values, result, addAndScaleWithUniformizationRate);
+                    }
+                    if (steadyStateReached) {
+                        STORM_LOG_DEBUG("Detected steady state after " << index << " of " << foxGlynnResult.right << " iterations.");
+                        ValueType remainingWeight = getRemainingWeight(index);
+                        std::function<ValueType(ValueType const&, ValueType const&)> addRemaining = [&remainingWeight] (ValueType const& a, ValueType const& b) { return a + remainingWeight * b; };
+                        storm::utility::vector::applyPointwise(result, values, result, addRemaining);
+                        return result;
                     }
                 }
                 
@@ -741,15 +895,102 @@ namespace storm {
                 ValueType weight = 0;
                 std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
                 for (uint_fast64_t index = startingIteration; index <= foxGlynnResult.right; ++index) {
-                    multiplier->multiply(env, values, addVector, values);
+                    bool steadyStateReached = performIteration();
                     
                     weight = foxGlynnResult.weights[index - foxGlynnResult.left];
+                    if (steadyStateReached) {
+                        // Add the weights of all remaining iterations at once.
+                        STORM_LOG_DEBUG("Detected steady state after " << index << " of " << foxGlynnResult.right << " iterations.");
+                        weight += getRemainingWeight(index);
+                        storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+                        break;
+                    }
                     storm::utility::vector::applyPointwise(result, values, result, addAndScale);
                 }
                 
                 return result;
             }
             
+            template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<ValueType> values) {
+                std::vector<std::vector<ValueType>> result(timeBounds.size());
+                
+                // Use Fox-Glynn to get the truncation points and the weights for each time bound. Time bounds for which
+                // no time can pass are already finished with the current values.
+                std::vector<storm::utility::numerical::FoxGlynnResult<ValueType>> foxGlynnResults(timeBounds.size());
+                storm::storage::BitVector unfinishedTimeBounds(timeBounds.size());
+                uint64_t maximalRightTruncationPoint = 0;
+                ValueType epsilon = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision() / 8.0;
+                for (uint64_t index = 0; index < timeBounds.size(); ++index) {
+                    ValueType lambda = timeBounds[index] * uniformizationRate;
+                    if (storm::utility::isZero(lambda)) {
+                        result[index] = values;
+                        continue;
+                    }
+                    
+                    auto& foxGlynnResult = foxGlynnResults[index];
+                    foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
+                    STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[index] << ": left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
+                    
+                    // Scale the weights so they add up to one.
+                    for (auto& element : foxGlynnResult.weights) {
+                        element /= foxGlynnResult.totalWeight;
+                    }
+                    
+                    if (foxGlynnResult.left == 0) {
+                        result[index] = values;
+                        storm::utility::vector::scaleVectorInPlace(result[index], foxGlynnResult.weights.front());
+                    } else {
+                        result[index] = std::vector<ValueType>(values.size(), storm::utility::zero<ValueType>());
+                    }
+                    unfinishedTimeBounds.set(index);
+                    maximalRightTruncationPoint = std::max(maximalRightTruncationPoint, foxGlynnResult.right);
+                }
+                
+                if (unfinishedTimeBounds.empty()) {
+                    return result;
+                }
+                
+                STORM_LOG_DEBUG("Starting " << maximalRightTruncationPoint << " iterations for " << unfinishedTimeBounds.getNumberOfSetBits() << " time bounds with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
+                
+                // Perform the matrix-vector multiplications only once and add the scaled values to the results of all time
+                // bounds whose truncation window contains the current iteration.
+                // If the values do not change any more, the weights of all remaining iterations are added at once.
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+                bool detectSteadyState = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isSteadyStateDetectionSet();
+                std::vector<ValueType> nextValues(values.size());
+                ValueType weight = 0;
+                std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
+                for (uint64_t iteration = 1; iteration <= maximalRightTruncationPoint; ++iteration) {
+                    multiplier->multiply(env, values, addVector, nextValues);
+                    bool steadyStateReached = detectSteadyState && storm::utility::vector::equalModuloPrecision<ValueType>(values, nextValues, epsilon, false);
+                    std::swap(values, nextValues);
+                    if (steadyStateReached) {
+                        STORM_LOG_DEBUG("Detected steady state after " << iteration << " of " << maximalRightTruncationPoint << " iterations.");
+                    }
+                    
+                    for (auto index : unfinishedTimeBounds) {
+                        auto const& foxGlynnResult = foxGlynnResults[index];
+                        if (iteration > foxGlynnResult.right) {
+                            continue;
+                        }
+                        weight = storm::utility::zero<ValueType>();
+                        for (uint64_t weightIndex = std::max(iteration, foxGlynnResult.left); weightIndex <= (steadyStateReached ? foxGlynnResult.right : iteration); ++weightIndex) {
+                            weight += foxGlynnResult.weights[weightIndex - foxGlynnResult.left];
+                        }
+                        if (!storm::utility::isZero(weight)) {
+                            storm::utility::vector::applyPointwise(result[index], values, result[index], addAndScale);
+                        }
+                    }
+                    
+                    if (steadyStateReached) {
+                        break;
+                    }
+                }
+                
+                return result;
+            }
+            
             template <typename ValueType>
             storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRates) {
                 // Turn the rates into probabilities by scaling each row with the exit rate of the state.
@@ -780,6 +1021,7 @@ namespace storm {
             
             
             template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, std::vector<double> const& upperBounds);
             
             template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, std::vector<double> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
 
@@ -802,10 +1044,13 @@ namespace storm {
             template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, double uniformizationRate, std::vector<double> const& exitRates);
             
             template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values);
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values);
 
 #ifdef STORM_HAVE_CARL
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+            template std::vector<std::vector<storm::RationalNumber>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, std::vector<double> const& upperBounds);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound);
+            template std::vector<std::vector<storm::RationalFunction>> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, std::vector<double> const& upperBounds);
 
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, std::vector<storm::RationalFunction> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
@@ -22,6 +22,7 @@
 #include "storm/storage/expressions/ExpressionManager.h"
 
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/Multiplier.h"
 #include "storm/solver/LpSolver.h"
 
 #include "storm/exceptions/InvalidStateException.h"
@@ -33,151 +34,161 @@ namespace storm {
     namespace modelchecker {
         namespace helper {
             
+            /*!
+             * Computes an order of the states of the given (acyclic) nondeterministic transition matrix in which every
+             * state appears after all of its successors.
+             */
             template<typename ValueType>
-            void calculateUnifPlusVector(Environment const& env, uint64_t k, uint64_t state, uint64_t const kind, ValueType lambda, uint64_t numberOfProbabilisticChoices, std::vector<std::vector<ValueType>> const & relativeReachability, OptimizationDirection dir, std::vector<std::vector<std::vector<ValueType>>>& unifVectors, storm::storage::SparseMatrix<ValueType> const& fullTransitionMatrix, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> const& solver, storm::utility::numerical::FoxGlynnResult<ValueType> const& poisson, bool cycleFree) {
-                
-                if (unifVectors[kind][k][state] != -1) {
-                    // Result already calculated.
-                    return;
-                }
-                
-                auto numberOfStates = fullTransitionMatrix.getRowGroupCount();
-                uint64_t N = unifVectors[kind].size() - 1;
-                auto const& rowGroupIndices = fullTransitionMatrix.getRowGroupIndices();
-                ValueType res;
-                
-                // First case, k==N, independent from kind of state.
-                if (k == N) {
-                    unifVectors[kind][k][state] = storm::utility::zero<ValueType>();
-                    return;
-                }
-                
-                // Goal state, independent from kind of state.
-                if (psiStates[state]) {
-                    if (kind == 0) {
-                        // Vd
-                        res = storm::utility::zero<ValueType>();
-                        for (uint64_t i = k; i < N; ++i){
-                            if (i >= poisson.left && i <= poisson.right) {
-                                ValueType between = poisson.weights[i - poisson.left];
-                                res += between;
+            std::vector<uint64_t> getSuccessorsFirstOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                std::vector<uint64_t> result;
+                result.reserve(numberOfStates);
+                
+                // Perform a depth-first search and record the states in post-order. The flag of the stack entries
+                // indicates whether the successors of the state have already been put on the stack.
+                storm::storage::BitVector visitedStates(numberOfStates);
+                std::vector<std::pair<uint64_t, bool>> stack;
+                for (uint64_t initialState = 0; initialState < numberOfStates; ++initialState) {
+                    if (visitedStates.get(initialState)) {
+                        continue;
+                    }
+                    stack.emplace_back(initialState, false);
+                    
+                    while (!stack.empty()) {
+                        std::pair<uint64_t, bool> current = stack.back();
+                        stack.pop_back();
+                        if (current.second) {
+                            result.push_back(current.first);
+                            continue;
+                        }
+                        if (visitedStates.get(current.first)) {
+                            continue;
+                        }
+                        visitedStates.set(current.first);
+                        stack.emplace_back(current.first, true);
+                        for (auto const& entry : transitionMatrix.getRowGroup(current.first)) {
+                            if (!visitedStates.get(entry.getColumn())) {
+                                stack.emplace_back(entry.getColumn(), false);
                             }
                         }
-                        unifVectors[kind][k][state] = res;
-                    } else {
-                        // WU
-                        unifVectors[kind][k][state] = storm::utility::one<ValueType>();
                     }
-                    return;
                 }
                 
-                // Markovian non-goal state.
-                if (markovianStates[state]) {
-                    res = storm::utility::zero<ValueType>();
-                    for (auto const& element : fullTransitionMatrix.getRow(rowGroupIndices[state])) {
-                        uint64_t to = element.getColumn();
-                        if (unifVectors[kind][k+1][to] == -1) {
-                            calculateUnifPlusVector(env, k+1, to, kind, lambda, numberOfProbabilisticChoices, relativeReachability, dir, unifVectors, fullTransitionMatrix, markovianStates, psiStates, solver, poisson, cycleFree);
-                        }
-                        res += element.getValue()*unifVectors[kind][k+1][to];
-                    }
-                    unifVectors[kind][k][state]=res;
+                return result;
+            }
+            
+            /*!
+             * Computes the values of the probabilistic (non-goal) states for one step of the Unif+ vectors, given the
+             * values of all Markovian and goal states of the same step.
+             */
+            template<typename ValueType>
+            void computeUnifPlusProbabilisticValues(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& values, storm::storage::SparseMatrix<ValueType> const& fullTransitionMatrix, storm::storage::BitVector const& probabilisticStates, std::vector<uint64_t> const& probabilisticStatesInOrder, storm::solver::Multiplier<ValueType> const* probabilisticToMarkovianMultiplier, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> const& solver, std::vector<ValueType>& markovianValues, std::vector<ValueType>& b, std::vector<ValueType>& x) {
+                if (probabilisticStates.empty()) {
                     return;
                 }
                 
-                // Probabilistic non-goal state.
-                if (cycleFree) {
-                    // If the model is cycle free, do "slight value iteration". (What is that?)
-                    res = -1;
-                    for (uint64_t i = rowGroupIndices[state]; i < rowGroupIndices[state + 1]; ++i) {
-                        auto row = fullTransitionMatrix.getRow(i);
-                        ValueType between = 0;
-                        for (auto const& element : row) {
-                            uint64_t successor = element.getColumn();
-                            
-                            // This should never happen, right? The model has no cycles, and therefore also no self-loops.
-                            if (successor == state) {
-                                continue;
-                            }
-                            
-                            if (unifVectors[kind][k][successor] == -1) {
-                                calculateUnifPlusVector(env, k, successor, kind, lambda, numberOfProbabilisticChoices, relativeReachability, dir, unifVectors, fullTransitionMatrix, markovianStates, psiStates, solver, poisson, cycleFree);
+                if (!solver) {
+                    // If the probabilistic states are cycle free, we can compute their values by processing them in an
+                    // order in which all successors of a state are processed before the state itself.
+                    auto const& rowGroupIndices = fullTransitionMatrix.getRowGroupIndices();
+                    for (auto const& state : probabilisticStatesInOrder) {
+                        ValueType result = storm::utility::zero<ValueType>();
+                        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                            ValueType rowValue = storm::utility::zero<ValueType>();
+                            for (auto const& element : fullTransitionMatrix.getRow(row)) {
+                                rowValue += element.getValue() * values[element.getColumn()];
                             }
-                            between += element.getValue() * unifVectors[kind][k][successor];
-                        }
-                        if (maximize(dir)) {
-                            res = storm::utility::max(res, between);
-                        } else {
-                            if (res != -1) {
-                                res = storm::utility::min(res, between);
+                            if (row == rowGroupIndices[state]) {
+                                result = rowValue;
+                            } else if (maximize(dir)) {
+                                result = storm::utility::max(result, rowValue);
                             } else {
-                                res = between;
+                                result = storm::utility::min(result, rowValue);
                             }
                         }
+                        values[state] = result;
                     }
-                    unifVectors[kind][k][state] = res;
                     return;
                 }
                 
-                // If we arrived at this point, the model is not cycle free. Use the solver to solve the unterlying equation system.
-                uint64_t numberOfProbabilisticStates = numberOfStates - markovianStates.getNumberOfSetBits();
-                std::vector<ValueType> b(numberOfProbabilisticChoices, storm::utility::zero<ValueType>());
-                std::vector<ValueType> x(numberOfProbabilisticStates, storm::utility::zero<ValueType>());
-                
-                // Compute right-hand side vector b.
-                uint64_t row = 0;
-                for (uint64_t i = 0; i < numberOfStates; ++i) {
-                    if (markovianStates[i]) {
-                        continue;
-                    }
-
-                    for (auto j = rowGroupIndices[i]; j < rowGroupIndices[i + 1]; j++) {
-                        uint64_t stateCount = 0;
-                        res = storm::utility::zero<ValueType>();
-                        for (auto const& element : fullTransitionMatrix.getRow(j)) {
-                            auto successor = element.getColumn();
-                            if (!markovianStates[successor]) {
-                                continue;
-                            }
-                            
-                            if (unifVectors[kind][k][successor] == -1) {
-                                calculateUnifPlusVector(env, k, successor, kind, lambda, numberOfProbabilisticStates, relativeReachability, dir, unifVectors, fullTransitionMatrix, markovianStates, psiStates, solver,  poisson, cycleFree);
-                            }
-                            res = res + relativeReachability[j][stateCount] * unifVectors[kind][k][successor];
-                            ++stateCount;
-                        }
-                        
-                        b[row] = res;
-                        ++row;
-                    }
-                }
-                
-                // Solve the equation system.
+                // Otherwise, we solve the equation system of the probabilistic states in which the right-hand side is
+                // given by the probabilities to go to Markovian and goal states.
+                storm::utility::vector::selectVectorValues(markovianValues, ~probabilisticStates, values);
+                probabilisticToMarkovianMultiplier->multiply(env, markovianValues, nullptr, b);
+                std::fill(x.begin(), x.end(), storm::utility::zero<ValueType>());
                 solver->solveEquations(env, dir, x, b);
-
-                // Expand the solution for the probabilistic states to all states.
-                storm::utility::vector::setVectorValues(unifVectors[kind][k], ~markovianStates, x);
+                storm::utility::vector::setVectorValues(values, probabilisticStates, x);
             }
             
-            template <typename ValueType>
-            void calculateVu(Environment const& env, std::vector<std::vector<ValueType>> const& relativeReachability, OptimizationDirection dir, uint64_t k, uint64_t state, uint64_t const kind, ValueType lambda, uint64_t numberOfProbabilisticStates, std::vector<std::vector<std::vector<ValueType>>>& unifVectors, storm::storage::SparseMatrix<ValueType> const& fullTransitionMatrix, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& psiStates, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> const& solver, storm::utility::numerical::FoxGlynnResult<ValueType> const & poisson, bool cycleFree) {
+            /*!
+             * Computes the vectors vd and vu of Unif+ for step 0 by sweeping over the steps from N - 1 down to 0. In
+             * each step, the values of the Markovian states are obtained by one multiplication with the values of the
+             * next step and the values of the probabilistic states by one (min-max) solve for all of them. As vu is
+             * only needed for step 0, it is accumulated from the vectors wu on the fly, so only the vectors of two
+             * consecutive steps need to be kept in memory.
+             *
+             * @return The vectors vd and vu for step 0.
+             */
+            template<typename ValueType>
+            std::pair<std::vector<ValueType>, std::vector<ValueType>> computeUnifPlusVectors(Environment const& env, OptimizationDirection dir, uint64_t N, storm::utility::numerical::FoxGlynnResult<ValueType> const& poisson, storm::storage::SparseMatrix<ValueType> const& fullTransitionMatrix, storm::storage::BitVector const& markovianNonGoalStates, storm::storage::BitVector const& probabilisticStates, storm::storage::BitVector const& psiStates, std::vector<uint64_t> const& probabilisticStatesInOrder, storm::solver::Multiplier<ValueType> const* probabilisticToMarkovianMultiplier, uint64_t numberOfProbabilisticChoices, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> const& solver) {
+                uint64_t numberOfStates = fullTransitionMatrix.getRowGroupCount();
                 
-                // Avoiding multiple computation of the same value.
-                if (unifVectors[1][k][state] != -1) {
-                    return;
+                // The transitions of the Markovian states are uniformized, so we can compute their values by a
+                // plain matrix-vector multiplication.
+                storm::storage::SparseMatrix<ValueType> markovianMatrix = fullTransitionMatrix.getSubmatrix(true, markovianNonGoalStates, storm::storage::BitVector(numberOfStates, true));
+                std::unique_ptr<storm::solver::Multiplier<ValueType>> markovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, markovianMatrix);
+                
+                auto poissonWeight = [&poisson] (uint64_t i) {
+                    return (i >= poisson.left && i <= poisson.right) ? poisson.weights[i - poisson.left] : storm::utility::zero<ValueType>();
+                };
+                
+                // The vectors of step N are zero.
+                std::vector<ValueType> vd(numberOfStates, storm::utility::zero<ValueType>());
+                std::vector<ValueType> wu(numberOfStates, storm::utility::zero<ValueType>());
+                std::vector<ValueType> vu(numberOfStates, storm::utility::zero<ValueType>());
+                std::vector<ValueType> nextVd(numberOfStates);
+                std::vector<ValueType> nextWu(numberOfStates);
+                
+                // Auxiliary storage that is reused in every step.
+                std::vector<ValueType> markovianResult(markovianNonGoalStates.getNumberOfSetBits());
+                std::vector<ValueType> markovianValues;
+                std::vector<ValueType> b;
+                std::vector<ValueType> x;
+                if (solver) {
+                    markovianValues.resize(numberOfStates - probabilisticStates.getNumberOfSetBits());
+                    b.resize(numberOfProbabilisticChoices);
+                    x.resize(probabilisticStates.getNumberOfSetBits());
                 }
-                uint64_t N = unifVectors[1].size() - 1;
-
-                ValueType res = storm::utility::zero<ValueType>();
-                for (uint64_t i = k; i < N; ++i) {
-                    if (unifVectors[2][N-1-(i-k)][state] == -1) {
-                       calculateUnifPlusVector(env, N-1-(i-k), state, 2, lambda, numberOfProbabilisticStates, relativeReachability, dir, unifVectors, fullTransitionMatrix, markovianStates, psiStates, solver, poisson, cycleFree);
-                    }
-                    if (i >= poisson.left && i <= poisson.right) {
-                        res += poisson.weights[i - poisson.left] * unifVectors[2][N-1-(i-k)][state];
+                
+                // The value of goal states in vd at step k is the probability of at least k but less than N jumps.
+                ValueType goalValue = storm::utility::zero<ValueType>();
+                for (uint64_t k = N; k > 0;) {
+                    --k;
+                    std::swap(vd, nextVd);
+                    std::swap(wu, nextWu);
+                    
+                    goalValue += poissonWeight(k);
+                    storm::utility::vector::setVectorValues(vd, psiStates, goalValue);
+                    storm::utility::vector::setVectorValues(wu, psiStates, storm::utility::one<ValueType>());
+                    
+                    markovianMultiplier->multiply(env, nextVd, nullptr, markovianResult);
+                    storm::utility::vector::setVectorValues(vd, markovianNonGoalStates, markovianResult);
+                    markovianMultiplier->multiply(env, nextWu, nullptr, markovianResult);
+                    storm::utility::vector::setVectorValues(wu, markovianNonGoalStates, markovianResult);
+                    
+                    computeUnifPlusProbabilisticValues(env, dir, vd, fullTransitionMatrix, probabilisticStates, probabilisticStatesInOrder, probabilisticToMarkovianMultiplier, solver, markovianValues, b, x);
+                    computeUnifPlusProbabilisticValues(env, dir, wu, fullTransitionMatrix, probabilisticStates, probabilisticStatesInOrder, probabilisticToMarkovianMultiplier, solver, markovianValues, b, x);
+                    
+                    // Step k of wu contributes to vu at step 0 with the probability of exactly N - 1 - k jumps.
+                    ValueType weight = poissonWeight(N - 1 - k);
+                    if (!storm::utility::isZero(weight)) {
+                        for (uint64_t state = 0; state < numberOfStates; ++state) {
+                            vu[state] += weight * wu[state];
+                        }
                     }
                 }
-                unifVectors[1][k][state] = res;
+                
+                return std::make_pair(std::move(vd), std::move(vu));
             }
 
             template <typename ValueType>
@@ -226,9 +237,6 @@ namespace storm {
                 storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(transitionMatrix, probabilisticStates, true, false);
                 bool cycleFree = sccDecomposition.empty();
                 
-                // Vectors to store computed vectors.
-                std::vector<std::vector<std::vector<ValueType>>> unifVectors(3);
-
                 // Transitions from goal states will be ignored. However, we mark them as non-probabilistic to make sure
                 // we do not apply the MDP algorithm to them.
                 storm::storage::BitVector markovianAndGoalStates = markovianStates | psiStates;
@@ -265,23 +273,17 @@ namespace storm {
                 uint64_t N;
                 ValueType maxNorm = storm::utility::zero<ValueType>();
 
-                // Compute the relative reachability vectors and create solver for models with SCCs.
-                std::vector<std::vector<ValueType>> relativeReachabilities(transitionMatrix.getRowCount());
+                // Create the solver for the probabilistic states (if they contain cycles) or compute an order in which
+                // they can be processed (otherwise).
+                storm::storage::SparseMatrix<ValueType> probabilisticToMarkovianMatrix;
+                std::unique_ptr<storm::solver::Multiplier<ValueType>> probabilisticToMarkovianMultiplier;
                 std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> solver;
+                std::vector<uint64_t> probabilisticStatesInOrder;
                 if (!cycleFree) {
-                    for (uint64_t i = 0; i < numberOfStates; i++) {
-                        if (markovianAndGoalStates[i]) {
-                            continue;
-                        }
-
-                        for (auto j = rowGroupIndices[i]; j < rowGroupIndices[i + 1]; ++j) {
-                            for (auto const& element : fullTransitionMatrix.getRow(j)) {
-                                if (markovianAndGoalStates[element.getColumn()]) {
-                                    relativeReachabilities[j].push_back(element.getValue());
-                                }
-                            }
-                        }
-                    }
+                    // The probabilities to go from probabilistic states to Markovian (or goal) states form the
+                    // right-hand side of the equation system of the probabilistic states.
+                    probabilisticToMarkovianMatrix = fullTransitionMatrix.getSubmatrix(true, probabilisticStates, markovianAndGoalStates);
+                    probabilisticToMarkovianMultiplier = storm::solver::MultiplierFactory<ValueType>().create(env, probabilisticToMarkovianMatrix);
 
                     // Create solver.
                     storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType> minMaxLinearEquationSolverFactory;
@@ -296,10 +298,16 @@ namespace storm {
                         solver->setRequirementsChecked();
                         solver->setCachingEnabled(true);
                     }
+                } else if (numberOfProbabilisticChoices > 0) {
+                    std::vector<uint64_t> probabilisticStateIndices(probabilisticStates.begin(), probabilisticStates.end());
+                    for (auto const& localState : getSuccessorsFirstOrder(probMatrix)) {
+                        probabilisticStatesInOrder.push_back(probabilisticStateIndices[localState]);
+                    }
                 }
+                storm::storage::BitVector markovianNonGoalStates = markovianStates & ~psiStates;
 
                 // Loop until result is within precision bound.
-                std::vector<ValueType> init(numberOfStates, -1);
+                std::vector<ValueType> result;
                 do {
                     maxNorm = storm::utility::zero<ValueType>();
 
@@ -345,26 +353,13 @@ namespace storm {
                         element /= foxGlynnResult.totalWeight;
                     }
 
-                    // (4) Define vectors/matrices.
-                    std::vector<std::vector<ValueType>> v = std::vector<std::vector<ValueType>>(N + 1, init);
-
-                    unifVectors[0] = v;
-                    unifVectors[1] = v;
-                    unifVectors[2] = v;
-
-                    // Define 0=vd, 1=vu, 2=wu.
-                    // (5) Compute vectors and maxNorm.
-                    for (uint64_t i = 0; i < numberOfStates; ++i) {
-                        for (uint64_t k = N; k <= N; --k) {
-                            calculateUnifPlusVector(env, k, i, 0, lambda, numberOfProbabilisticChoices, relativeReachabilities, dir, unifVectors, fullTransitionMatrix, markovianAndGoalStates, psiStates, solver, foxGlynnResult, cycleFree);
-                            calculateUnifPlusVector(env, k, i, 2, lambda, numberOfProbabilisticChoices, relativeReachabilities, dir, unifVectors, fullTransitionMatrix, markovianAndGoalStates, psiStates, solver, foxGlynnResult, cycleFree);
-                            calculateVu(env, relativeReachabilities, dir, k, i, 1, lambda, numberOfProbabilisticChoices, unifVectors, fullTransitionMatrix, markovianAndGoalStates, psiStates, solver, foxGlynnResult, cycleFree);
-                        }
-                    }
+                    // (4) + (5) Compute vectors vd and vu (for step 0) and maxNorm.
+                    std::pair<std::vector<ValueType>, std::vector<ValueType>> unifVectors = computeUnifPlusVectors(env, dir, N, foxGlynnResult, fullTransitionMatrix, markovianNonGoalStates, probabilisticStates, psiStates, probabilisticStatesInOrder, probabilisticToMarkovianMultiplier.get(), numberOfProbabilisticChoices, solver);
+                    result = std::move(unifVectors.first);
 
                     // Only iterate over result vector, as the results can only get more precise.
                     for (uint64_t i = 0; i < numberOfStates; i++){
-                        ValueType diff = storm::utility::abs(unifVectors[0][0][i] - unifVectors[1][0][i]);
+                        ValueType diff = storm::utility::abs(result[i] - unifVectors.second[i]);
                         maxNorm = std::max(maxNorm, diff);
                     }
 
@@ -374,7 +369,7 @@ namespace storm {
 
                 } while (maxNorm > epsilon * (1 - kappa));
 
-                return unifVectors[0][0];
+                return result;
             }
 
             template <typename ValueType>
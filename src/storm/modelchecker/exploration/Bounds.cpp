@@ -6,12 +6,26 @@ namespace storm {
     namespace modelchecker {
         namespace exploration_detail {
             
+            template<typename StateType, typename ValueType>
+            Bounds<StateType, ValueType>::Bounds(std::size_t numberOfMutexes) : mutexes(numberOfMutexes) {
+                // Intentionally left empty.
+            }
+            
+            template<typename StateType, typename ValueType>
+            std::unique_lock<std::mutex> Bounds<StateType, ValueType>::lock(StateType const& index) const {
+                if (mutexes.empty()) {
+                    return std::unique_lock<std::mutex>();
+                }
+                return std::unique_lock<std::mutex>(mutexes[index % mutexes.size()]);
+            }
+            
             template<typename StateType, typename ValueType>
             std::pair<ValueType, ValueType> Bounds<StateType, ValueType>::getBoundsForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const {
                 ActionType index = explorationInformation.getRowGroup(state);
                 if (index == explorationInformation.getUnexploredMarker()) {
                     return std::make_pair(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
                 } else {
+                    std::unique_lock<std::mutex> rowGroupLock = lock(index);
                     return boundsPerState[index];
                 }
             }
@@ -27,7 +41,8 @@ namespace storm {
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getLowerBoundForRowGroup(StateType const& rowGroup) const {
+            ValueType Bounds<StateType, ValueType>::getLowerBoundForRowGroup(StateType const& rowGroup) const {
+                std::unique_lock<std::mutex> rowGroupLock = lock(rowGroup);
                 return boundsPerState[rowGroup].first;
             }
             
@@ -42,27 +57,31 @@ namespace storm {
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getUpperBoundForRowGroup(StateType const& rowGroup) const {
+            ValueType Bounds<StateType, ValueType>::getUpperBoundForRowGroup(StateType const& rowGroup) const {
+                std::unique_lock<std::mutex> rowGroupLock = lock(rowGroup);
                 return boundsPerState[rowGroup].second;
             }
             
             template<typename StateType, typename ValueType>
-            std::pair<ValueType, ValueType> const& Bounds<StateType, ValueType>::getBoundsForAction(ActionType const& action) const {
+            std::pair<ValueType, ValueType> Bounds<StateType, ValueType>::getBoundsForAction(ActionType const& action) const {
+                std::unique_lock<std::mutex> actionLock = lock(action);
                 return boundsPerAction[action];
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getLowerBoundForAction(ActionType const& action) const {
+            ValueType Bounds<StateType, ValueType>::getLowerBoundForAction(ActionType const& action) const {
+                std::unique_lock<std::mutex> actionLock = lock(action);
                 return boundsPerAction[action].first;
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getUpperBoundForAction(ActionType const& action) const {
+            ValueType Bounds<StateType, ValueType>::getUpperBoundForAction(ActionType const& action) const {
+                std::unique_lock<std::mutex> actionLock = lock(action);
                 return boundsPerAction[action].second;
             }
             
             template<typename StateType, typename ValueType>
-            ValueType const& Bounds<StateType, ValueType>::getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const {
+            ValueType Bounds<StateType, ValueType>::getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const {
                 if (direction == storm::OptimizationDirection::Maximize) {
                     return getUpperBoundForAction(action);
                 } else {
@@ -84,6 +103,7 @@ namespace storm {
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::initializeBoundsForNextAction(std::pair<ValueType, ValueType> const& vals) {
                 boundsPerAction.push_back(vals);
+                numberOfUpdatesPerAction.push_back(0);
             }
             
             template<typename StateType, typename ValueType>
@@ -93,6 +113,7 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setLowerBoundForRowGroup(StateType const& group, ValueType const& value) {
+                std::unique_lock<std::mutex> rowGroupLock = lock(group);
                 boundsPerState[group].first = value;
             }
             
@@ -103,12 +124,15 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setUpperBoundForRowGroup(StateType const& group, ValueType const& value) {
+                std::unique_lock<std::mutex> rowGroupLock = lock(group);
                 boundsPerState[group].second = value;
             }
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setBoundsForAction(ActionType const& action, std::pair<ValueType, ValueType> const& values) {
+                std::unique_lock<std::mutex> actionLock = lock(action);
                 boundsPerAction[action] = values;
+                ++numberOfUpdatesPerAction[action];
             }
             
             template<typename StateType, typename ValueType>
@@ -119,12 +143,14 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void Bounds<StateType, ValueType>::setBoundsForRowGroup(StateType const& rowGroup, std::pair<ValueType, ValueType> const& values) {
+                std::unique_lock<std::mutex> rowGroupLock = lock(rowGroup);
                 boundsPerState[rowGroup] = values;
             }
             
             template<typename StateType, typename ValueType>
             bool Bounds<StateType, ValueType>::setLowerBoundOfStateIfGreaterThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newLowerValue) {
                 StateType const& rowGroup = explorationInformation.getRowGroup(state);
+                std::unique_lock<std::mutex> rowGroupLock = lock(rowGroup);
                 if (boundsPerState[rowGroup].first < newLowerValue) {
                     boundsPerState[rowGroup].first = newLowerValue;
                     return true;
@@ -135,6 +161,7 @@ namespace storm {
             template<typename StateType, typename ValueType>
             bool Bounds<StateType, ValueType>::setUpperBoundOfStateIfLessThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newUpperValue) {
                 StateType const& rowGroup = explorationInformation.getRowGroup(state);
+                std::unique_lock<std::mutex> rowGroupLock = lock(rowGroup);
                 if (newUpperValue < boundsPerState[rowGroup].second) {
                     boundsPerState[rowGroup].second = newUpperValue;
                     return true;
@@ -142,6 +169,35 @@ namespace storm {
                 return false;
             }
             
+            template<typename StateType, typename ValueType>
+            uint32_t Bounds<StateType, ValueType>::getNumberOfUpdatesOfAction(ActionType const& action) const {
+                std::unique_lock<std::mutex> actionLock = lock(action);
+                return numberOfUpdatesPerAction[action];
+            }
+            
+            template<typename StateType, typename ValueType>
+            std::size_t Bounds<StateType, ValueType>::getMemoryUsage() const {
+                return boundsPerState.size() * sizeof(std::pair<ValueType, ValueType>) + boundsPerAction.size() * (sizeof(std::pair<ValueType, ValueType>) + sizeof(uint32_t));
+            }
+            
+            template<typename StateType, typename ValueType>
+            void Bounds<StateType, ValueType>::compact(std::vector<StateType> const& newToOldRowGroup, std::vector<ActionType> const& newToOldAction) {
+                std::vector<std::pair<ValueType, ValueType>> newBoundsPerState;
+                newBoundsPerState.reserve(newToOldRowGroup.size());
+                for (auto const& oldRowGroup : newToOldRowGroup) {
+                    newBoundsPerState.push_back(boundsPerState[oldRowGroup]);
+                }
+                boundsPerState = std::move(newBoundsPerState);
+                
+                std::vector<std::pair<ValueType, ValueType>> newBoundsPerAction;
+                newBoundsPerAction.reserve(newToOldAction.size());
+                for (auto const& oldAction : newToOldAction) {
+                    newBoundsPerAction.push_back(boundsPerAction[oldAction]);
+                }
+                boundsPerAction = std::move(newBoundsPerAction);
+                numberOfUpdatesPerAction = std::vector<uint32_t>(boundsPerAction.size(), 0);
+            }
+            
             template class Bounds<uint32_t, double>;
             
         }
@@ -1,6 +1,8 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_BOUNDS_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_BOUNDS_H_
 
+#include <cstdint>
+#include <mutex>
 #include <vector>
 #include <utility>
 
@@ -20,23 +22,33 @@ namespace storm {
             public:
                 typedef StateType ActionType;
                 
+                /*!
+                 * Creates an empty structure of bounds.
+                 *
+                 * @param numberOfMutexes If non-zero, every access to a bound is guarded by one of the given number of
+                 * mutexes, which allows to update the bounds from several threads. The bounds of a state (action) are
+                 * guarded by the mutex whose index is the index of its row group (action) modulo the number of mutexes.
+                 * Growing the structure, however, requires exclusive access.
+                 */
+                Bounds(std::size_t numberOfMutexes = 0);
+                
                 std::pair<ValueType, ValueType> getBoundsForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
                 ValueType getLowerBoundForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
-                ValueType const& getLowerBoundForRowGroup(StateType const& rowGroup) const;
+                ValueType getLowerBoundForRowGroup(StateType const& rowGroup) const;
                 
                 ValueType getUpperBoundForState(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
-                ValueType const& getUpperBoundForRowGroup(StateType const& rowGroup) const;
+                ValueType getUpperBoundForRowGroup(StateType const& rowGroup) const;
                 
-                std::pair<ValueType, ValueType> const& getBoundsForAction(ActionType const& action) const;
+                std::pair<ValueType, ValueType> getBoundsForAction(ActionType const& action) const;
                 
-                ValueType const& getLowerBoundForAction(ActionType const& action) const;
+                ValueType getLowerBoundForAction(ActionType const& action) const;
                 
-                ValueType const& getUpperBoundForAction(ActionType const& action) const;
+                ValueType getUpperBoundForAction(ActionType const& action) const;
                 
-                ValueType const& getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const;
+                ValueType getBoundForAction(storm::OptimizationDirection const& direction, ActionType const& action) const;
                 
                 ValueType getDifferenceOfStateBounds(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
@@ -62,9 +74,36 @@ namespace storm {
                 
                 bool setUpperBoundOfStateIfLessThanOld(StateType const& state, ExplorationInformation<StateType, ValueType> const& explorationInformation, ValueType const& newUpperValue);
                 
+                /*!
+                 * Retrieves how often the bounds of the given action were set since the last compaction. This serves as
+                 * an indicator of how often the action is part of sampled paths.
+                 */
+                uint32_t getNumberOfUpdatesOfAction(ActionType const& action) const;
+                
+                /*!
+                 * Retrieves an estimate of the memory (in bytes) needed to store the bounds.
+                 */
+                std::size_t getMemoryUsage() const;
+                
+                /*!
+                 * Keeps only the bounds of the given row groups and actions (in the given order) and resets the number
+                 * of updates of all actions. This needs to accompany the compaction of the exploration information.
+                 *
+                 * @param newToOldRowGroup The mapping from the new to the old row group indices.
+                 * @param newToOldAction The mapping from the new to the old action indices.
+                 */
+                void compact(std::vector<StateType> const& newToOldRowGroup, std::vector<ActionType> const& newToOldAction);
+                
             private:
+                /*!
+                 * Locks the mutex guarding the bounds with the given index (if there are mutexes).
+                 */
+                std::unique_lock<std::mutex> lock(StateType const& index) const;
+                
                 std::vector<std::pair<ValueType, ValueType>> boundsPerState;
                 std::vector<std::pair<ValueType, ValueType>> boundsPerAction;
+                std::vector<uint32_t> numberOfUpdatesPerAction;
+                mutable std::vector<std::mutex> mutexes;
             };
             
         }
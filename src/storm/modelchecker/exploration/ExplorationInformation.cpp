@@ -3,6 +3,8 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/ExplorationSettings.h"
 
+#include "storm-config.h"
+
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -10,7 +12,7 @@ namespace storm {
         namespace exploration_detail {
             
             template<typename StateType, typename ValueType>
-            ExplorationInformation<StateType, ValueType>::ExplorationInformation(storm::OptimizationDirection const& direction, ActionType const& unexploredMarker) : unexploredMarker(unexploredMarker), optimizationDirection(direction), localPrecomputation(false), numberOfExplorationStepsUntilPrecomputation(100000), numberOfSampledPathsUntilPrecomputation(), nextStateHeuristic(storm::settings::modules::ExplorationSettings::NextStateHeuristic::DifferenceProbabilitySum) {
+            ExplorationInformation<StateType, ValueType>::ExplorationInformation(storm::OptimizationDirection const& direction, ActionType const& unexploredMarker) : matrixRevision(0), numberOfTransitions(0), unexploredMarker(unexploredMarker), optimizationDirection(direction), localPrecomputation(false), numberOfExplorationStepsUntilPrecomputation(100000), numberOfSampledPathsUntilPrecomputation(), numberOfExplorationStepsSinceLastPrecomputation(0), numberOfSampledPathsSinceLastPrecomputation(0), nextStateHeuristic(storm::settings::modules::ExplorationSettings::NextStateHeuristic::DifferenceProbabilitySum), numberOfThreads(1), memoryCap(), memoryUsageUntilEviction(0), numberOfRowGroupsAtLastEviction(std::numeric_limits<StateType>::max()) {
                 
                 storm::settings::modules::ExplorationSettings const& settings = storm::settings::getModule<storm::settings::modules::ExplorationSettings>();
                 localPrecomputation = settings.isLocalPrecomputationSet();
@@ -20,6 +22,17 @@ namespace storm {
                 }
                 
                 nextStateHeuristic = settings.getNextStateHeuristic();
+                
+                numberOfThreads = settings.getNumberOfThreads();
+#ifndef STORM_HAVE_INTELTBB
+                STORM_LOG_WARN_COND(numberOfThreads == 1, "Concurrent path sampling requires Intel TBB. Paths are sampled sequentially.");
+                numberOfThreads = 1;
+#endif
+                
+                if (settings.isMemoryCapSet()) {
+                    memoryCap = static_cast<std::size_t>(settings.getMemoryCap() * 1024 * 1024);
+                    memoryUsageUntilEviction = memoryCap.get();
+                }
             }
             
             template<typename StateType, typename ValueType>
@@ -43,6 +56,11 @@ namespace storm {
                 unexploredStates[stateId] = compressedState;
             }
             
+            template<typename StateType, typename ValueType>
+            void ExplorationInformation<StateType, ValueType>::addEvictedState(StateType const& stateId, storm::generator::CompressedState const& compressedState) {
+                unexploredStates[stateId] = compressedState;
+            }
+            
             template<typename StateType, typename ValueType>
             void ExplorationInformation<StateType, ValueType>::assignStateToRowGroup(StateType const& state, ActionType const& rowGroup) {
                 stateToRowGroupMapping[state] = rowGroup;
@@ -71,12 +89,23 @@ namespace storm {
             
             template<typename StateType, typename ValueType>
             void ExplorationInformation<StateType, ValueType>::terminateCurrentRowGroup() {
+                for (ActionType action = rowGroupIndices.back(); action < matrix.size(); ++action) {
+                    numberOfTransitions += matrix[action].size();
+                }
                 rowGroupIndices.push_back(matrix.size());
             }
             
             template<typename StateType, typename ValueType>
             void ExplorationInformation<StateType, ValueType>::moveActionToBackOfMatrix(ActionType const& action) {
+                // The transitions are counted again once the row group they are moved to is terminated.
+                numberOfTransitions -= matrix[action].size();
                 matrix.emplace_back(std::move(matrix[action]));
+                ++matrixRevision;
+            }
+            
+            template<typename StateType, typename ValueType>
+            std::size_t ExplorationInformation<StateType, ValueType>::getMatrixRevision() const {
+                return matrixRevision;
             }
             
             template<typename StateType, typename ValueType>
@@ -160,25 +189,33 @@ namespace storm {
             }
             
             template<typename StateType, typename ValueType>
-            bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiveExplorationSteps(std::size_t& numberExplorationStepsSinceLastPrecomputation) const {
-                bool result = numberExplorationStepsSinceLastPrecomputation > numberOfExplorationStepsUntilPrecomputation;
-                if (result) {
-                    numberExplorationStepsSinceLastPrecomputation = 0;
+            void ExplorationInformation<StateType, ValueType>::explorationStep() {
+                ++numberOfExplorationStepsSinceLastPrecomputation;
+            }
+            
+            template<typename StateType, typename ValueType>
+            void ExplorationInformation<StateType, ValueType>::sampledPath() {
+                ++numberOfSampledPathsSinceLastPrecomputation;
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiveExplorationSteps() {
+                if (numberOfExplorationStepsSinceLastPrecomputation <= numberOfExplorationStepsUntilPrecomputation) {
+                    return false;
                 }
-                return result;
+                
+                // Only the caller that resets the counter has to perform the precomputation.
+                return numberOfExplorationStepsSinceLastPrecomputation.exchange(0) > numberOfExplorationStepsUntilPrecomputation;
             }
             
             template<typename StateType, typename ValueType>
-            bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiveSampledPaths(std::size_t& numberOfSampledPathsSinceLastPrecomputation) const {
-                if (!numberOfSampledPathsUntilPrecomputation) {
+            bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiveSampledPaths() {
+                if (!numberOfSampledPathsUntilPrecomputation || numberOfSampledPathsSinceLastPrecomputation <= numberOfSampledPathsUntilPrecomputation.get()) {
                     return false;
-                } else {
-                    bool result = numberOfSampledPathsSinceLastPrecomputation > numberOfSampledPathsUntilPrecomputation.get();
-                    if (result) {
-                        numberOfSampledPathsSinceLastPrecomputation = 0;
-                    }
-                    return result;
                 }
+                
+                // Only the caller that resets the counter has to perform the precomputation.
+                return numberOfSampledPathsSinceLastPrecomputation.exchange(0) > numberOfSampledPathsUntilPrecomputation.get();
             }
             
             template<typename StateType, typename ValueType>
@@ -221,6 +258,114 @@ namespace storm {
                 optimizationDirection = direction;
             }
             
+            template<typename StateType, typename ValueType>
+            uint_fast64_t ExplorationInformation<StateType, ValueType>::getNumberOfThreads() const {
+                return numberOfThreads;
+            }
+            
+            template<typename StateType, typename ValueType>
+            std::shared_timed_mutex& ExplorationInformation<StateType, ValueType>::getMutex() const {
+                return mutex;
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool ExplorationInformation<StateType, ValueType>::isMemoryCapSet() const {
+                return static_cast<bool>(memoryCap);
+            }
+            
+            template<typename StateType, typename ValueType>
+            std::size_t ExplorationInformation<StateType, ValueType>::getMemoryCap() const {
+                return memoryCap.get();
+            }
+            
+            template<typename StateType, typename ValueType>
+            std::size_t ExplorationInformation<StateType, ValueType>::getMemoryUsage() const {
+                std::size_t result = matrix.size() * sizeof(typename MatrixType::value_type) + numberOfTransitions * sizeof(storm::storage::MatrixEntry<StateType, ValueType>);
+                result += (rowGroupIndices.size() + stateToRowGroupMapping.size() + terminalStates.size()) * sizeof(StateType);
+                if (!unexploredStates.empty()) {
+                    // Besides the entry itself, the hash map stores (roughly) two pointers per entry.
+                    std::size_t bytesPerState = sizeof(typename IdToStateMap::value_type) + 2 * sizeof(void*) + (unexploredStates.begin()->second.size() + 63) / 64 * 8;
+                    result += unexploredStates.size() * bytesPerState;
+                }
+                return result;
+            }
+            
+            template<typename StateType, typename ValueType>
+            std::size_t ExplorationInformation<StateType, ValueType>::getMemoryUsageOfRowGroup(StateType const& group) const {
+                std::size_t result = (getRowGroupSize(group) - 1) * sizeof(typename MatrixType::value_type);
+                for (ActionType action = getStartRowOfGroup(group); action < getStartRowOfGroup(group + 1); ++action) {
+                    result += matrix[action].size() * sizeof(storm::storage::MatrixEntry<StateType, ValueType>);
+                }
+                return result;
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool ExplorationInformation<StateType, ValueType>::isEvictionDue(std::size_t const& memoryUsage) const {
+                return memoryCap && memoryUsage > memoryUsageUntilEviction;
+            }
+            
+            template<typename StateType, typename ValueType>
+            void ExplorationInformation<StateType, ValueType>::evictionPerformed(std::size_t const& memoryUsage) {
+                // If the eviction could not free enough memory, we wait until the memory usage grew by a quarter of the
+                // cap to avoid evicting states after every exploration step.
+                memoryUsageUntilEviction = std::max(memoryCap.get(), memoryUsage + memoryCap.get() / 4);
+                numberOfRowGroupsAtLastEviction = getNextRowGroup();
+            }
+            
+            template<typename StateType, typename ValueType>
+            StateType ExplorationInformation<StateType, ValueType>::getNumberOfRowGroupsAtLastEviction() const {
+                return numberOfRowGroupsAtLastEviction;
+            }
+            
+            template<typename StateType, typename ValueType>
+            void ExplorationInformation<StateType, ValueType>::compact(storm::storage::BitVector const& rowGroupsWithoutBehavior, std::vector<StateType>& newToOldRowGroup, std::vector<ActionType>& newToOldAction) {
+                StateType numberOfRowGroups = getNextRowGroup();
+                STORM_LOG_ASSERT(rowGroupIndices.back() == matrix.size(), "Expected all row groups to be terminated.");
+                
+                // Determine the row groups that are still assigned to some state.
+                storm::storage::BitVector usedRowGroups(numberOfRowGroups);
+                for (auto const& rowGroup : stateToRowGroupMapping) {
+                    if (rowGroup != unexploredMarker) {
+                        usedRowGroups.set(rowGroup);
+                    }
+                }
+                
+                newToOldRowGroup.clear();
+                newToOldAction.clear();
+                std::vector<StateType> oldToNewRowGroup(numberOfRowGroups, unexploredMarker);
+                MatrixType newMatrix;
+                std::vector<StateType> newRowGroupIndices;
+                numberOfTransitions = 0;
+                for (auto rowGroup : usedRowGroups) {
+                    oldToNewRowGroup[rowGroup] = newToOldRowGroup.size();
+                    newToOldRowGroup.push_back(rowGroup);
+                    newRowGroupIndices.push_back(newMatrix.size());
+                    if (rowGroupsWithoutBehavior.get(rowGroup)) {
+                        // Like for terminal states, we keep a single empty action.
+                        newToOldAction.push_back(getStartRowOfGroup(rowGroup));
+                        newMatrix.emplace_back();
+                    } else {
+                        for (ActionType action = getStartRowOfGroup(rowGroup); action < getStartRowOfGroup(rowGroup + 1); ++action) {
+                            newToOldAction.push_back(action);
+                            numberOfTransitions += matrix[action].size();
+                            newMatrix.emplace_back(std::move(matrix[action]));
+                        }
+                    }
+                }
+                newRowGroupIndices.push_back(newMatrix.size());
+                
+                matrix = std::move(newMatrix);
+                rowGroupIndices = std::move(newRowGroupIndices);
+                for (auto& rowGroup : stateToRowGroupMapping) {
+                    if (rowGroup != unexploredMarker) {
+                        rowGroup = oldToNewRowGroup[rowGroup];
+                    }
+                }
+                
+                // The actions of sampled paths are no longer valid.
+                ++matrixRevision;
+            }
+            
             template class ExplorationInformation<uint32_t, double>;
         }
     }
@@ -1,8 +1,10 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_EXPLORATIONINFORMATION_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_EXPLORATIONINFORMATION_H_
 
+#include <atomic>
 #include <vector>
 #include <limits>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include <boost/optional.hpp>
@@ -13,6 +15,7 @@
 #include "storm/generator/CompressedState.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
 
 #include "storm/settings/modules/ExplorationSettings.h"
 
@@ -38,6 +41,12 @@ namespace storm {
                 
                 void addUnexploredState(StateType const& stateId, storm::generator::CompressedState const& compressedState);
                 
+                /*!
+                 * Marks the given (explored) state as unexplored again. In contrast to newly discovered states, the
+                 * state keeps its row group until it is explored again, so its bounds remain available.
+                 */
+                void addEvictedState(StateType const& stateId, storm::generator::CompressedState const& compressedState);
+                
                 void assignStateToRowGroup(StateType const& state, ActionType const& rowGroup);
                 
                 StateType assignStateToNextRowGroup(StateType const& state);
@@ -52,6 +61,12 @@ namespace storm {
                 
                 void moveActionToBackOfMatrix(ActionType const& action);
                 
+                /*!
+                 * Retrieves a number that is increased whenever actions are moved within the matrix. If it changes
+                 * while a path is sampled, the actions recorded for the path may no longer be valid.
+                 */
+                std::size_t getMatrixRevision() const;
+                
                 StateType getActionCount() const;
                 
                 std::size_t getNumberOfUnexploredStates() const;
@@ -84,9 +99,24 @@ namespace storm {
                 
                 bool minimize() const;
                 
-                bool performPrecomputationExcessiveExplorationSteps(std::size_t& numberExplorationStepsSinceLastPrecomputation) const;
+                /*!
+                 * Notifies about a performed exploration step. The steps of all threads are counted together.
+                 */
+                void explorationStep();
+                
+                /*!
+                 * Notifies about a sampled path. The paths of all threads are counted together.
+                 */
+                void sampledPath();
+                
+                /*!
+                 * Retrieves whether a precomputation is due, because of the number of exploration steps (sampled paths)
+                 * since the last precomputation. If so, the counter is reset, so that among concurrent callers only one
+                 * is asked to perform the precomputation.
+                 */
+                bool performPrecomputationExcessiveExplorationSteps();
                 
-                bool performPrecomputationExcessiveSampledPaths(std::size_t& numberOfSampledPathsSinceLastPrecomputation) const;
+                bool performPrecomputationExcessiveSampledPaths();
                 
                 bool useLocalPrecomputation() const;
                 
@@ -104,9 +134,73 @@ namespace storm {
                 
                 void setOptimizationDirection(storm::OptimizationDirection const& direction);
                 
+                /*!
+                 * Retrieves the number of threads that concurrently sample paths.
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Retrieves the mutex that guards the exploration information (and the size of the bounds) against
+                 * concurrent sampling threads. Modifying the structure (e.g. adding states or actions) requires
+                 * exclusive ownership, sampling a path (and updating the values of bounds) requires shared ownership.
+                 */
+                std::shared_timed_mutex& getMutex() const;
+                
+                /*!
+                 * Retrieves whether a memory cap was set for the explored part of the model.
+                 */
+                bool isMemoryCapSet() const;
+                
+                /*!
+                 * Retrieves the memory cap (in bytes) for the explored part of the model.
+                 */
+                std::size_t getMemoryCap() const;
+                
+                /*!
+                 * Retrieves an estimate of the memory (in bytes) needed to store the exploration information.
+                 */
+                std::size_t getMemoryUsage() const;
+                
+                /*!
+                 * Retrieves an estimate of the memory (in bytes) that is freed by dropping all but one (empty) action of
+                 * the given row group.
+                 */
+                std::size_t getMemoryUsageOfRowGroup(StateType const& group) const;
+                
+                /*!
+                 * Retrieves whether states need to be evicted, because the given memory usage (of the exploration
+                 * information and the bounds) exceeds the memory cap (and grew sufficiently since the last eviction).
+                 */
+                bool isEvictionDue(std::size_t const& memoryUsage) const;
+                
+                /*!
+                 * Notifies about an eviction of states after which the given amount of memory is used.
+                 */
+                void evictionPerformed(std::size_t const& memoryUsage);
+                
+                /*!
+                 * Retrieves the number of row groups right after the last eviction. Row groups with greater indices were
+                 * created since then. Before the first eviction, all row groups count as old (i.e. the maximal value is
+                 * returned), so that already the first eviction may evict unconverged states.
+                 */
+                StateType getNumberOfRowGroupsAtLastEviction() const;
+                
+                /*!
+                 * Removes all row groups that are not assigned to any state and drops all but one (empty) action of the
+                 * given row groups. The remaining row groups and actions are renumbered consecutively (keeping their
+                 * order). This must only be done when all row groups are terminated.
+                 *
+                 * @param rowGroupsWithoutBehavior The row groups whose actions are to be dropped.
+                 * @param newToOldRowGroup Is set to the mapping from the new to the old row group indices.
+                 * @param newToOldAction Is set to the mapping from the new to the old action indices.
+                 */
+                void compact(storm::storage::BitVector const& rowGroupsWithoutBehavior, std::vector<StateType>& newToOldRowGroup, std::vector<ActionType>& newToOldAction);
+                
             private:
                 MatrixType matrix;
                 std::vector<StateType> rowGroupIndices;
+                std::size_t matrixRevision;
+                std::size_t numberOfTransitions;
                 
                 std::vector<StateType> stateToRowGroupMapping;
                 StateType unexploredMarker;
@@ -118,8 +212,17 @@ namespace storm {
                 bool localPrecomputation;
                 std::size_t numberOfExplorationStepsUntilPrecomputation;
                 boost::optional<std::size_t> numberOfSampledPathsUntilPrecomputation;
+                std::atomic<std::size_t> numberOfExplorationStepsSinceLastPrecomputation;
+                std::atomic<std::size_t> numberOfSampledPathsSinceLastPrecomputation;
                 
                 storm::settings::modules::ExplorationSettings::NextStateHeuristic nextStateHeuristic;
+                
+                uint_fast64_t numberOfThreads;
+                mutable std::shared_timed_mutex mutex;
+                
+                boost::optional<std::size_t> memoryCap;
+                std::size_t memoryUsageUntilEviction;
+                StateType numberOfRowGroupsAtLastEviction;
             };
         }
     }
@@ -1,5 +1,15 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/modelchecker/exploration/Bounds.h"
@@ -7,6 +17,7 @@
 
 #include "storm/generator/CompressedState.h"
 
+#include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 
@@ -37,7 +48,7 @@ namespace storm {
     namespace modelchecker {
         
         template<typename ModelType, typename StateType>
-        SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program) : program(program.substituteConstantsFormulas()), randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()), comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
+        SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program) : program(program.substituteConstantsFormulas()), seedGenerator(std::chrono::system_clock::now().time_since_epoch().count()), comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
             // Intentionally left empty.
         }
         
@@ -76,46 +87,95 @@ namespace storm {
             STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException, "Currently only models with one initial state are supported by the exploration engine.");
             StateType initialStateIndex = stateGeneration.getFirstInitialState();
             
-            // Create a structure that holds the bounds for the states and actions.
-            Bounds<StateType, ValueType> bounds;
+            // Create a structure that holds the bounds for the states and actions. If several threads sample paths,
+            // the accesses to the bounds are guarded by mutexes that are each shared by only a few states (actions).
+            uint_fast64_t numberOfThreads = explorationInformation.getNumberOfThreads();
+            Bounds<StateType, ValueType> bounds(numberOfThreads > 1 ? 64 * numberOfThreads : 0);
             
-            // Create a stack that is used to track the path we sampled.
-            StateActionStack stack;
+            // Every thread keeps its own statistics and random number generator.
+            std::vector<Statistics<StateType, ValueType>> statsPerThread(numberOfThreads);
+            std::vector<std::default_random_engine> randomGenerators;
+            for (uint_fast64_t thread = 0; thread < numberOfThreads; ++thread) {
+                randomGenerators.emplace_back(seedGenerator());
+            }
             
-            // Now perform the actual sampling.
-            Statistics<StateType, ValueType> stats;
-            bool convergenceCriterionMet = false;
-            while (!convergenceCriterionMet) {
-                bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, stats);
-                
-                stats.sampledPath();
-                stats.updateMaxPathLength(stack.size());
-                
-                // If a terminal state was found, we update the probabilities along the path contained in the stack.
-                if (result) {
-                    // Update the bounds along the path to the terminal state.
-                    STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
-                    updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
-                } else {
-                    // If not terminal state was found, the search aborted, possibly because of an EC-detection. In this
-                    // case, we cannot update the probabilities.
-                    STORM_LOG_TRACE("Did not find terminal state.");
-                }
+            // Now perform the actual sampling. Every thread samples paths until one of them observes convergence.
+            std::atomic<bool> convergenceCriterionMet(false);
+            auto samplePaths = [&] (uint_fast64_t thread) {
+                Statistics<StateType, ValueType>& stats = statsPerThread[thread];
                 
-                STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates << " explored, " << explorationInformation.getNumberOfUnexploredStates() << " unexplored).");
-                STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", " << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
-                ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
-                STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
-                convergenceCriterionMet = comparator.isZero(difference);
+                // Create a stack that is used to track the path we sampled.
+                StateActionStack stack;
                 
-                // If the number of sampled paths exceeds a certain threshold, do a precomputation.
-                if (!convergenceCriterionMet && explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
-                    performPrecomputation(stack, explorationInformation, bounds, stats);
+                while (!convergenceCriterionMet) {
+                    std::size_t matrixRevision;
+                    {
+                        std::shared_lock<std::shared_timed_mutex> lock(explorationInformation.getMutex());
+                        matrixRevision = explorationInformation.getMatrixRevision();
+                    }
+                    bool result = samplePathFromInitialState(stateGeneration, thread, explorationInformation, stack, bounds, stats, randomGenerators[thread]);
+                    
+                    stats.sampledPath();
+                    explorationInformation.sampledPath();
+                    stats.updateMaxPathLength(stack.size());
+                    
+                    std::shared_lock<std::shared_timed_mutex> lock(explorationInformation.getMutex());
+                    
+                    // If a terminal state was found, we update the probabilities along the path contained in the stack.
+                    if (result && matrixRevision == explorationInformation.getMatrixRevision()) {
+                        // Update the bounds along the path to the terminal state.
+                        STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+                        updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+                    } else if (result) {
+                        // If a precomputation of another thread collapsed end components while the path was sampled,
+                        // the actions on the path may have been moved, so we cannot update the probabilities.
+                        STORM_LOG_TRACE("Found terminal state, but the matrix changed while sampling the path.");
+                        stack.clear();
+                    } else {
+                        // If not terminal state was found, the search aborted, possibly because of an EC-detection. In this
+                        // case, we cannot update the probabilities.
+                        STORM_LOG_TRACE("Did not find terminal state.");
+                    }
+                    
+                    STORM_LOG_DEBUG("Discovered states: " << explorationInformation.getNumberOfDiscoveredStates() << " (" << stats.numberOfExploredStates << " explored, " << explorationInformation.getNumberOfUnexploredStates() << " unexplored).");
+                    STORM_LOG_DEBUG("Value of initial state is in [" << bounds.getLowerBoundForState(initialStateIndex, explorationInformation) << ", " << bounds.getUpperBoundForState(initialStateIndex, explorationInformation) << "].");
+                    ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
+                    STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
+                    lock.unlock();
+                    
+                    if (comparator.isZero(difference)) {
+                        convergenceCriterionMet = true;
+                    } else if (explorationInformation.performPrecomputationExcessiveSampledPaths()) {
+                        // If the number of sampled paths (of all threads) exceeds a certain threshold, do a precomputation.
+                        std::unique_lock<std::shared_timed_mutex> exclusiveLock(explorationInformation.getMutex());
+                        performPrecomputation(stack, explorationInformation, bounds, stats);
+                    }
                 }
+            };
+            
+            if (numberOfThreads == 1) {
+                samplePaths(0);
+            } else {
+#ifdef STORM_HAVE_INTELTBB
+                tbb::task_arena arena(static_cast<int>(numberOfThreads));
+                arena.execute([&] () {
+                    tbb::task_group threads;
+                    for (uint_fast64_t thread = 0; thread < numberOfThreads; ++thread) {
+                        threads.run([&samplePaths, thread] () { samplePaths(thread); });
+                    }
+                    threads.wait();
+                });
+#else
+                STORM_LOG_ASSERT(false, "Concurrent path sampling requires Intel TBB.");
+#endif
             }
             
             // Show statistics if required.
             if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                Statistics<StateType, ValueType> stats;
+                for (auto const& threadStats : statsPerThread) {
+                    stats.add(threadStats);
+                }
                 stats.printToStream(std::cout, explorationInformation);
             }
             
@@ -123,7 +183,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename StateType>
-        bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
+        bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, uint_fast64_t const& thread, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::default_random_engine& randomGenerator) const {
             // Start the search from the initial state.
             stack.push_back(std::make_pair(stateGeneration.getFirstInitialState(), 0));
             
@@ -133,18 +193,50 @@ namespace storm {
                 StateType const& currentStateId = stack.back().first;
                 STORM_LOG_TRACE("State on top of stack is: " << currentStateId << ".");
                 
-                // If the state is not yet explored, we need to retrieve its behaviors.
-                auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
-                if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+                std::shared_lock<std::shared_timed_mutex> lock(explorationInformation.getMutex());
+                
+                // If the state is not yet explored (or was evicted), we need to retrieve its behaviors.
+                if (explorationInformation.isUnexplored(currentStateId) || explorationInformation.findUnexploredState(currentStateId) != explorationInformation.unexploredStatesEnd()) {
                     STORM_LOG_TRACE("State was not yet explored.");
+                    lock.unlock();
+                    
+                    // Remove the state from the unexplored states, so no other thread explores it concurrently.
+                    std::unique_lock<std::shared_timed_mutex> exclusiveLock(explorationInformation.getMutex());
+                    auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+                    if (unexploredIt == explorationInformation.unexploredStatesEnd()) {
+                        // As the behavior of the state is not yet known, we cannot continue the path.
+                        STORM_LOG_TRACE("Aborting sampling of path, because the state is being explored by another thread.");
+                        stack.clear();
+                        return false;
+                    }
+                    storm::generator::CompressedState compressedState = unexploredIt->second;
+                    explorationInformation.removeUnexploredState(unexploredIt);
+                    
+                    // If the state was evicted, its row group still holds the bounds that were known before.
+                    std::pair<ValueType, ValueType> knownBounds = bounds.getBoundsForState(currentStateId, explorationInformation);
+                    explorationInformation.assignStateToRowGroup(currentStateId, explorationInformation.getUnexploredMarker());
+                    exclusiveLock.unlock();
                     
                     // Explore the previously unexplored state.
-                    storm::generator::CompressedState const& compressedState = unexploredIt->second;
-                    foundTerminalState = exploreState(stateGeneration, currentStateId, compressedState, explorationInformation, bounds, stats);
+                    foundTerminalState = exploreState(stateGeneration, thread, currentStateId, compressedState, knownBounds, explorationInformation, bounds, stats);
                     if (foundTerminalState) {
                         STORM_LOG_TRACE("Aborting sampling of path, because a terminal state was reached.");
                     }
-                    explorationInformation.removeUnexploredState(unexploredIt);
+                    lock.lock();
+                    
+                    // If the explored part of the model needs too much memory, we evict states. As this renumbers the
+                    // actions, we abort the search.
+                    if (explorationInformation.isEvictionDue(explorationInformation.getMemoryUsage() + bounds.getMemoryUsage())) {
+                        lock.unlock();
+                        exclusiveLock.lock();
+                        if (explorationInformation.isEvictionDue(explorationInformation.getMemoryUsage() + bounds.getMemoryUsage())) {
+                            evictStates(stateGeneration, explorationInformation, bounds, stats);
+                        }
+                        
+                        STORM_LOG_TRACE("Aborting the search after eviction.");
+                        stack.clear();
+                        return false;
+                    }
                 } else {
                     // If the state was already explored, we check whether it is a terminal state or not.
                     if (explorationInformation.isTerminal(currentStateId)) {
@@ -155,23 +247,26 @@ namespace storm {
                 
                 // Notify the stats about the performed exploration step.
                 stats.explorationStep();
+                explorationInformation.explorationStep();
                 
                 // If the state was not a terminal state, we continue the path search and sample the next state.
                 if (!foundTerminalState) {
                     // At this point, we can be sure that the state was expanded and that we can sample according to the
                     // probabilities in the matrix.
-                    uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+                    uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
                     stack.back().second = chosenAction;
                     STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
                     
-                    StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+                    StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator);
                     STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
                     
                     // Put the successor state and a dummy action on top of the stack.
                     stack.emplace_back(successor, 0);
+                    lock.unlock();
                     
-                    // If the number of exploration steps exceeds a certain threshold, do a precomputation.
-                    if (explorationInformation.performPrecomputationExcessiveExplorationSteps(stats.explorationStepsSinceLastPrecomputation)) {
+                    // If the number of exploration steps (of all threads) exceeds a certain threshold, do a precomputation.
+                    if (explorationInformation.performPrecomputationExcessiveExplorationSteps()) {
+                        std::unique_lock<std::shared_timed_mutex> exclusiveLock(explorationInformation.getMutex());
                         performPrecomputation(stack, explorationInformation, bounds, stats);
                         
                         STORM_LOG_TRACE("Aborting the search after precomputation.");
@@ -185,32 +280,26 @@ namespace storm {
         }
         
         template<typename ModelType, typename StateType>
-        bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId, storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
+        bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGeneration<StateType, ValueType>& stateGeneration, uint_fast64_t const& thread, StateType const& currentStateId, storm::generator::CompressedState const& currentState, std::pair<ValueType, ValueType> const& knownBounds, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
             bool isTerminalState = false;
             bool isTargetState = false;
             
             ++stats.numberOfExploredStates;
             
-            // Finally, map the unexplored state to the row group.
-            explorationInformation.assignStateToNextRowGroup(currentStateId);
-            STORM_LOG_TRACE("Assigning row group " << explorationInformation.getRowGroup(currentStateId) << " to state " << currentStateId << ".");
-            
-            // Initialize the bounds, because some of the following computations depend on the values to be available for
-            // all states that have been assigned to a row-group.
-            bounds.initializeBoundsForNextState();
-            
             // Before generating the behavior of the state, we need to determine whether it's a target state that
-            // does not need to be expanded.
-            stateGeneration.load(currentState);
-            if (stateGeneration.isTargetState()) {
+            // does not need to be expanded. This only uses the generator of the current thread, so other threads may
+            // sample paths in the meantime.
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            stateGeneration.load(currentState, thread);
+            if (stateGeneration.isTargetState(thread)) {
                 ++stats.numberOfTargetStates;
                 isTargetState = true;
                 isTerminalState = true;
-            } else if (stateGeneration.isConditionState()) {
+            } else if (stateGeneration.isConditionState(thread)) {
                 STORM_LOG_TRACE("Exploring state.");
                 
                 // If it needs to be expanded, we use the generator to retrieve the behavior of the new state.
-                storm::generator::StateBehavior<ValueType, StateType> behavior = stateGeneration.expand();
+                behavior = stateGeneration.expand(thread);
                 STORM_LOG_TRACE("State has " << behavior.getNumberOfChoices() << " choices.");
                 
                 // Clumsily check whether we have found a state that forms a trivial BMEC.
@@ -224,44 +313,57 @@ namespace storm {
                     }
                 }
                 isTerminalState = !otherSuccessor;
+            } else {
+                // In this case, the state is neither a target state nor a condition state and therefore a rejecting
+                // terminal state.
+                isTerminalState = true;
+            }
+            
+            // Storing the behavior of the state modifies the structure, so we need exclusive access.
+            std::unique_lock<std::shared_timed_mutex> lock(explorationInformation.getMutex());
+            
+            // Finally, map the unexplored state to the row group.
+            explorationInformation.assignStateToNextRowGroup(currentStateId);
+            STORM_LOG_TRACE("Assigning row group " << explorationInformation.getRowGroup(currentStateId) << " to state " << currentStateId << ".");
+            
+            // Initialize the bounds, because some of the following computations depend on the values to be available for
+            // all states that have been assigned to a row-group.
+            bounds.initializeBoundsForNextState();
+            
+            // If the state was neither a trivial (non-accepting) terminal state nor a target state, we
+            // need to store its behavior.
+            if (!isTerminalState) {
+                // Next, we insert the behavior into our matrix structure.
+                StateType startAction = explorationInformation.getActionCount();
+                explorationInformation.addActionsToMatrix(behavior.getNumberOfChoices());
                 
-                // If the state was neither a trivial (non-accepting) terminal state nor a target state, we
-                // need to store its behavior.
-                if (!isTerminalState) {
-                    // Next, we insert the behavior into our matrix structure.
-                    StateType startAction = explorationInformation.getActionCount();
-                    explorationInformation.addActionsToMatrix(behavior.getNumberOfChoices());
-                    
-                    ActionType localAction = 0;
-                    
-                    // Retrieve the lowest state bounds (wrt. to the current optimization direction).
-                    std::pair<ValueType, ValueType> stateBounds = getLowestBounds(explorationInformation.getOptimizationDirection());
-                    
-                    for (auto const& choice : behavior) {
-                        for (auto const& entry : choice) {
-                            explorationInformation.getRowOfMatrix(startAction + localAction).emplace_back(entry.first, entry.second);
-                            STORM_LOG_TRACE("Found transition " << currentStateId << "-[" << (startAction + localAction) << ", " << entry.second << "]-> " << entry.first << ".");
-                        }
-                        
-                        std::pair<ValueType, ValueType> actionBounds = computeBoundsOfAction(startAction + localAction, explorationInformation, bounds);
-                        bounds.initializeBoundsForNextAction(actionBounds);
-                        stateBounds = combineBounds(explorationInformation.getOptimizationDirection(), stateBounds, actionBounds);
-                        
-                        STORM_LOG_TRACE("Initializing bounds of action " << (startAction + localAction) << " to " << bounds.getLowerBoundForAction(startAction + localAction) << " and " << bounds.getUpperBoundForAction(startAction + localAction) << ".");
-                        
-                        ++localAction;
+                ActionType localAction = 0;
+                
+                // Retrieve the lowest state bounds (wrt. to the current optimization direction).
+                std::pair<ValueType, ValueType> stateBounds = getLowestBounds(explorationInformation.getOptimizationDirection());
+                
+                for (auto const& choice : behavior) {
+                    for (auto const& entry : choice) {
+                        explorationInformation.getRowOfMatrix(startAction + localAction).emplace_back(entry.first, entry.second);
+                        STORM_LOG_TRACE("Found transition " << currentStateId << "-[" << (startAction + localAction) << ", " << entry.second << "]-> " << entry.first << ".");
                     }
                     
-                    // Terminate the row group.
-                    explorationInformation.terminateCurrentRowGroup();
+                    std::pair<ValueType, ValueType> actionBounds = computeBoundsOfAction(startAction + localAction, explorationInformation, bounds);
+                    bounds.initializeBoundsForNextAction(actionBounds);
+                    stateBounds = combineBounds(explorationInformation.getOptimizationDirection(), stateBounds, actionBounds);
+                    
+                    STORM_LOG_TRACE("Initializing bounds of action " << (startAction + localAction) << " to " << bounds.getLowerBoundForAction(startAction + localAction) << " and " << bounds.getUpperBoundForAction(startAction + localAction) << ".");
                     
-                    bounds.setBoundsForState(currentStateId, explorationInformation, stateBounds);
-                    STORM_LOG_TRACE("Initializing bounds of state " << currentStateId << " to " << bounds.getLowerBoundForState(currentStateId, explorationInformation) << " and " << bounds.getUpperBoundForState(currentStateId, explorationInformation) << ".");
+                    ++localAction;
                 }
-            } else {
-                // In this case, the state is neither a target state nor a condition state and therefore a rejecting
-                // terminal state.
-                isTerminalState = true;
+                
+                // Terminate the row group.
+                explorationInformation.terminateCurrentRowGroup();
+                
+                // Bounds that were known before (i.e. if the state was evicted) remain valid.
+                stateBounds = std::make_pair(std::max(stateBounds.first, knownBounds.first), std::min(stateBounds.second, knownBounds.second));
+                bounds.setBoundsForState(currentStateId, explorationInformation, stateBounds);
+                STORM_LOG_TRACE("Initializing bounds of state " << currentStateId << " to " << bounds.getLowerBoundForState(currentStateId, explorationInformation) << " and " << bounds.getUpperBoundForState(currentStateId, explorationInformation) << ".");
             }
             
             if (isTerminalState) {
@@ -287,7 +389,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename StateType>
-        typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+        typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::default_random_engine& randomGenerator) const {
             // Determine the values of all available actions.
             std::vector<std::pair<ActionType, ValueType>> actionValues;
             StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -325,7 +427,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename StateType>
-        StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
+        StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::default_random_engine& randomGenerator) const {
             std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
             if (row.size() == 1) {
                 return row.front().getColumn();
@@ -369,10 +471,23 @@ namespace storm {
             // Construct the matrix that represents the fragment of the system contained in the currently sampled path.
             storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true, 0);
             
-            // Determine the set of states that was expanded.
+            // Determine the set of states that was expanded. The behavior of unexplored states (including the last
+            // state of the path and, if paths are sampled concurrently, states that other threads are currently
+            // exploring) and evicted states is not stored, so they are treated like the unexpanded sink. This also holds
+            // for the terminal states that were evicted because their bounds met, which (unlike the other terminal
+            // states) have bounds different from zero and one.
+            auto isBehaviorStored = [&explorationInformation, &bounds] (StateType const& state) {
+                if (explorationInformation.isUnexplored(state) || explorationInformation.findUnexploredState(state) != explorationInformation.unexploredStatesEnd()) {
+                    return false;
+                }
+                return !explorationInformation.isTerminal(state) || storm::utility::isZero(bounds.getUpperBoundForState(state, explorationInformation)) || storm::utility::isOne(bounds.getLowerBoundForState(state, explorationInformation));
+            };
             std::vector<StateType> relevantStates;
             if (explorationInformation.useLocalPrecomputation()) {
                 for (auto const& stateActionPair : stack) {
+                    if (!isBehaviorStored(stateActionPair.first)) {
+                        continue;
+                    }
                     if (explorationInformation.maximize() || !storm::utility::isOne(bounds.getLowerBoundForState(stateActionPair.first, explorationInformation))) {
                         relevantStates.push_back(stateActionPair.first);
                     }
@@ -382,8 +497,8 @@ namespace storm {
                 relevantStates.resize(std::distance(relevantStates.begin(), newEnd));
             } else {
                 for (StateType state = 0; state < explorationInformation.getNumberOfDiscoveredStates(); ++state) {
-                    // Add the state to the relevant states if they are not unexplored.
-                    if (!explorationInformation.isUnexplored(state)) {
+                    // Add the state to the relevant states if its behavior is stored.
+                    if (isBehaviorStored(state)) {
                         relevantStates.push_back(state);
                     }
                 }
@@ -502,6 +617,97 @@ namespace storm {
             return true;
         }
         
+        template<typename ModelType, typename StateType>
+        void SparseExplorationModelChecker<ModelType, StateType>::evictStates(StateGeneration<StateType, ValueType> const& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
+            ++stats.evictions;
+            
+            // We try to get well below the memory cap, so that evictions are not needed too often.
+            std::size_t memoryUsage = explorationInformation.getMemoryUsage() + bounds.getMemoryUsage();
+            std::size_t targetMemoryUsage = explorationInformation.getMemoryCap() / 4 * 3;
+            STORM_LOG_TRACE("Evicting states, because the explored part of the model needs about " << memoryUsage << " bytes.");
+            
+            // Determine how many states (and which state) each row group represents.
+            StateType numberOfRowGroups = explorationInformation.getNextRowGroup();
+            std::vector<StateType> numberOfStatesOfRowGroup(numberOfRowGroups, 0);
+            std::vector<StateType> stateOfRowGroup(numberOfRowGroups);
+            for (StateType state = 0; state < explorationInformation.getNumberOfDiscoveredStates(); ++state) {
+                StateType const& rowGroup = explorationInformation.getRowGroup(state);
+                if (rowGroup != explorationInformation.getUnexploredMarker()) {
+                    ++numberOfStatesOfRowGroup[rowGroup];
+                    stateOfRowGroup[rowGroup] = state;
+                }
+            }
+            
+            // First, we drop the behavior of all row groups whose bounds have met and make their states terminal. As
+            // their remaining difference is at most half the precision, this does not prevent convergence.
+            storm::utility::ConstantsComparator<ValueType> convergenceComparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision() / 2);
+            storm::storage::BitVector rowGroupsWithoutBehavior(numberOfRowGroups);
+            std::size_t freedMemory = 0;
+            for (StateType rowGroup = 0; rowGroup < numberOfRowGroups; ++rowGroup) {
+                if (numberOfStatesOfRowGroup[rowGroup] == 0 || explorationInformation.isTerminal(stateOfRowGroup[rowGroup]) || explorationInformation.findUnexploredState(stateOfRowGroup[rowGroup]) != explorationInformation.unexploredStatesEnd()) {
+                    continue;
+                }
+                if (convergenceComparator.isZero(bounds.getUpperBoundForRowGroup(rowGroup) - bounds.getLowerBoundForRowGroup(rowGroup))) {
+                    rowGroupsWithoutBehavior.set(rowGroup);
+                    freedMemory += explorationInformation.getMemoryUsageOfRowGroup(rowGroup);
+                }
+            }
+            for (StateType state = 0; state < explorationInformation.getNumberOfDiscoveredStates(); ++state) {
+                StateType const& rowGroup = explorationInformation.getRowGroup(state);
+                if (rowGroup != explorationInformation.getUnexploredMarker() && rowGroupsWithoutBehavior.get(rowGroup)) {
+                    explorationInformation.addTerminalState(state);
+                    ++stats.evictedConvergedStates;
+                }
+            }
+            
+            // If this does not suffice, we also evict the states whose actions were updated least often since the last
+            // eviction. To avoid evicting states right after exploring them, only states that were already explored at
+            // the time of the last eviction (if any) are considered. Evicted states become unexplored again, but keep
+            // their bounds until they are explored again.
+            std::vector<StateType> evictedStates;
+            if (memoryUsage > targetMemoryUsage + freedMemory) {
+                std::vector<std::pair<uint64_t, StateType>> numberOfUpdatesAndRowGroups;
+                for (StateType rowGroup = 0; rowGroup < std::min(numberOfRowGroups, explorationInformation.getNumberOfRowGroupsAtLastEviction()); ++rowGroup) {
+                    // Row groups of collapsed end components are not evicted, as they represent several states.
+                    if (numberOfStatesOfRowGroup[rowGroup] != 1 || rowGroupsWithoutBehavior.get(rowGroup) || explorationInformation.isTerminal(stateOfRowGroup[rowGroup]) || explorationInformation.findUnexploredState(stateOfRowGroup[rowGroup]) != explorationInformation.unexploredStatesEnd()) {
+                        continue;
+                    }
+                    uint64_t numberOfUpdates = 0;
+                    for (ActionType action = explorationInformation.getStartRowOfGroup(rowGroup); action < explorationInformation.getStartRowOfGroup(rowGroup + 1); ++action) {
+                        numberOfUpdates += bounds.getNumberOfUpdatesOfAction(action);
+                    }
+                    numberOfUpdatesAndRowGroups.emplace_back(numberOfUpdates, rowGroup);
+                }
+                std::sort(numberOfUpdatesAndRowGroups.begin(), numberOfUpdatesAndRowGroups.end());
+                
+                for (auto const& numberOfUpdatesAndRowGroup : numberOfUpdatesAndRowGroups) {
+                    if (memoryUsage <= targetMemoryUsage + freedMemory) {
+                        break;
+                    }
+                    rowGroupsWithoutBehavior.set(numberOfUpdatesAndRowGroup.second);
+                    evictedStates.push_back(stateOfRowGroup[numberOfUpdatesAndRowGroup.second]);
+                    freedMemory += explorationInformation.getMemoryUsageOfRowGroup(numberOfUpdatesAndRowGroup.second);
+                }
+                
+                std::vector<storm::generator::CompressedState> compressedStates = stateGeneration.getCompressedStates(evictedStates);
+                for (uint64_t index = 0; index < evictedStates.size(); ++index) {
+                    explorationInformation.addEvictedState(evictedStates[index], compressedStates[index]);
+                }
+                stats.evictedUnconvergedStates += evictedStates.size();
+            }
+            
+            // Finally, remove the dropped behavior (and the row groups no longer used) from the structures.
+            std::vector<StateType> newToOldRowGroup;
+            std::vector<ActionType> newToOldAction;
+            explorationInformation.compact(rowGroupsWithoutBehavior, newToOldRowGroup, newToOldAction);
+            bounds.compact(newToOldRowGroup, newToOldAction);
+            
+            memoryUsage = explorationInformation.getMemoryUsage() + bounds.getMemoryUsage();
+            explorationInformation.evictionPerformed(memoryUsage);
+            STORM_LOG_DEBUG("Evicted " << rowGroupsWithoutBehavior.getNumberOfSetBits() << " row group(s), " << evictedStates.size() << " of which became unexplored again. The explored part of the model now needs about " << memoryUsage << " bytes.");
+            STORM_LOG_WARN_COND(memoryUsage <= explorationInformation.getMemoryCap(), "Unable to reduce the memory needed for the explored part of the model below the memory cap.");
+        }
+        
         template<typename ModelType, typename StateType>
         void SparseExplorationModelChecker<ModelType, StateType>::collapseMec(storm::storage::MaximalEndComponent const& mec, std::vector<StateType> const& relevantStates, storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
             bool containsTargetState = false;
@@ -638,7 +844,8 @@ namespace storm {
                         newBoundsForAction.second = std::max(newBoundsForAction.second, computeBoundOverAllOtherActions(storm::OptimizationDirection::Maximize, state, action, explorationInformation, bounds));
                     }
                     
-                    bounds.setUpperBoundForRowGroup(rowGroup, newBoundsForAction.second);
+                    // Other threads may have decreased the bound in the meantime, so we only keep the smaller one.
+                    bounds.setUpperBoundOfStateIfLessThanOld(state, explorationInformation, newBoundsForAction.second);
                 }
             } else {
                 bounds.setUpperBoundOfStateIfLessThanOld(state, explorationInformation, newBoundsForAction.second);
@@ -650,7 +857,8 @@ namespace storm {
                         newBoundsForAction.first = std::min(newBoundsForAction.first, min);
                     }
                     
-                    bounds.setLowerBoundForRowGroup(rowGroup, newBoundsForAction.first);
+                    // Other threads may have increased the bound in the meantime, so we only keep the greater one.
+                    bounds.setLowerBoundOfStateIfGreaterThanOld(state, explorationInformation, newBoundsForAction.first);
                 }
             }
         }
@@ -49,16 +49,33 @@ namespace storm {
         private:
             std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation) const;
 
-            bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
+            /*!
+             * Samples a path from the initial state. The exploration information must not be owned by the calling
+             * thread, as ownership is acquired as needed.
+             */
+            bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, uint_fast64_t const& thread, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::default_random_engine& randomGenerator) const;
             
-            bool exploreState(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& currentStateId, storm::generator::CompressedState const& currentState, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
+            /*!
+             * Explores the given state that was removed from the unexplored states by the calling thread before. The
+             * exploration information must not be owned by the calling thread, as ownership is acquired as needed. The
+             * given bounds (e.g. known from before the state was evicted) are used to tighten the initial bounds.
+             */
+            bool exploreState(StateGeneration<StateType, ValueType>& stateGeneration, uint_fast64_t const& thread, StateType const& currentStateId, storm::generator::CompressedState const& currentState, std::pair<ValueType, ValueType> const& knownBounds, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
-            ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
+            ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds, std::default_random_engine& randomGenerator) const;
 
-            StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const;
+            StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds, std::default_random_engine& randomGenerator) const;
             
             bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
+            /*!
+             * Evicts states to reduce the memory needed for the explored part of the model. The behavior of states
+             * whose bounds have met is dropped and they become terminal. If necessary, also the least often updated
+             * states become unexplored again. The exploration information must be owned exclusively by the calling
+             * thread.
+             */
+            void evictStates(StateGeneration<StateType, ValueType> const& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
+            
             void collapseMec(storm::storage::MaximalEndComponent const& mec, std::vector<StateType> const& relevantStates, storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
             
             void updateProbabilityBoundsAlongSampledPath(StateActionStack& stack, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
@@ -78,8 +95,8 @@ namespace storm {
             // The program that defines the model to check.
             storm::prism::Program program;
             
-            // The random number generator.
-            mutable std::default_random_engine randomGenerator;
+            // The random number generator that seeds the random number generators of the sampling threads.
+            mutable std::default_random_engine seedGenerator;
             
             // A comparator used to determine whether values are equal.
             storm::utility::ConstantsComparator<ValueType> comparator;
@@ -1,15 +1,22 @@
 #include "storm/modelchecker/exploration/StateGeneration.h"
 
+#include <mutex>
+
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 
+#include "storm/utility/macros.h"
+
 namespace storm {
     namespace modelchecker {
         namespace exploration_detail {
             
             template <typename StateType, typename ValueType>
-            StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program const& program, ExplorationInformation<StateType, ValueType>& explorationInformation, storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression) : generator(program), stateStorage(generator.getStateSize()), conditionStateExpression(conditionStateExpression), targetStateExpression(targetStateExpression) {
+            StateGeneration<StateType, ValueType>::StateGeneration(storm::prism::Program const& program, ExplorationInformation<StateType, ValueType>& explorationInformation, storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression) : generators(createGenerators(program, explorationInformation.getNumberOfThreads())), stateStorage(generators.front()->getStateSize()), storeCompressedStates(explorationInformation.isMemoryCapSet()), conditionStateExpression(conditionStateExpression), targetStateExpression(targetStateExpression) {
                 
                 stateToIdCallback = [&explorationInformation, this] (storm::generator::CompressedState const& state) -> StateType {
+                    // The state storage and the exploration information are shared by all threads.
+                    std::unique_lock<std::shared_timed_mutex> lock(explorationInformation.getMutex());
+                    
                     StateType newIndex = stateStorage.getNumberOfStates();
                     
                     // Check, if the state was already registered.
@@ -17,6 +24,9 @@ namespace storm {
                     
                     if (actualIndexBucketPair.first == newIndex) {
                         explorationInformation.addUnexploredState(newIndex, state);
+                        if (storeCompressedStates) {
+                            idToState.push_back(state);
+                        }
                     }
                     
                     return actualIndexBucketPair.first;
@@ -24,8 +34,17 @@ namespace storm {
             }
             
             template <typename StateType, typename ValueType>
-            void StateGeneration<StateType, ValueType>::load(storm::generator::CompressedState const& state) {
-                generator.load(state);
+            std::vector<std::unique_ptr<storm::generator::PrismNextStateGenerator<ValueType, StateType>>> StateGeneration<StateType, ValueType>::createGenerators(storm::prism::Program const& program, uint64_t numberOfGenerators) {
+                std::vector<std::unique_ptr<storm::generator::PrismNextStateGenerator<ValueType, StateType>>> result;
+                for (uint64_t generator = 0; generator < numberOfGenerators; ++generator) {
+                    result.push_back(std::make_unique<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program));
+                }
+                return result;
+            }
+            
+            template <typename StateType, typename ValueType>
+            void StateGeneration<StateType, ValueType>::load(storm::generator::CompressedState const& state, uint64_t const& thread) {
+                generators[thread]->load(state);
             }
             
             template <typename StateType, typename ValueType>
@@ -34,23 +53,23 @@ namespace storm {
             }
             
             template <typename StateType, typename ValueType>
-            storm::generator::StateBehavior<ValueType, StateType> StateGeneration<StateType, ValueType>::expand() {
-                return generator.expand(stateToIdCallback);
+            storm::generator::StateBehavior<ValueType, StateType> StateGeneration<StateType, ValueType>::expand(uint64_t const& thread) {
+                return generators[thread]->expand(stateToIdCallback);
             }
             
             template <typename StateType, typename ValueType>
-            bool StateGeneration<StateType, ValueType>::isConditionState() const {
-                return generator.satisfies(conditionStateExpression);
+            bool StateGeneration<StateType, ValueType>::isConditionState(uint64_t const& thread) const {
+                return generators[thread]->satisfies(conditionStateExpression);
             }
             
             template <typename StateType, typename ValueType>
-            bool StateGeneration<StateType, ValueType>::isTargetState() const {
-                return generator.satisfies(targetStateExpression);
+            bool StateGeneration<StateType, ValueType>::isTargetState(uint64_t const& thread) const {
+                return generators[thread]->satisfies(targetStateExpression);
             }
             
             template<typename StateType, typename ValueType>
             void StateGeneration<StateType, ValueType>::computeInitialStates() {
-                stateStorage.initialStateIndices = generator.getInitialStates(stateToIdCallback);
+                stateStorage.initialStateIndices = generators.front()->getInitialStates(stateToIdCallback);
             }
             
             template<typename StateType, typename ValueType>
@@ -63,6 +82,17 @@ namespace storm {
                 return stateStorage.initialStateIndices.size();
             }
             
+            template<typename StateType, typename ValueType>
+            std::vector<storm::generator::CompressedState> StateGeneration<StateType, ValueType>::getCompressedStates(std::vector<StateType> const& states) const {
+                STORM_LOG_ASSERT(storeCompressedStates, "The compressed states are only stored if a memory cap is set.");
+                std::vector<storm::generator::CompressedState> result;
+                result.reserve(states.size());
+                for (auto const& state : states) {
+                    result.push_back(idToState[state]);
+                }
+                return result;
+            }
+            
             template class StateGeneration<uint32_t, double>;
         }
     }
@@ -1,6 +1,8 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 #define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_STATEGENERATION_H_
 
+#include <memory>
+
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/PrismNextStateGenerator.h"
 
@@ -18,16 +20,22 @@ namespace storm {
             template <typename StateType, typename ValueType>
             class ExplorationInformation;
             
+            /*!
+             * Generates the states of the model. Every sampling thread uses its own generator, so that states can be
+             * loaded and expanded concurrently. The registration of newly discovered states in the (shared) state
+             * storage and exploration information is performed while owning the mutex of the exploration information
+             * exclusively. Consequently, expanding a state must not be done while owning this mutex.
+             */
             template <typename StateType, typename ValueType>
             class StateGeneration {
             public:
                 StateGeneration(storm::prism::Program const& program, ExplorationInformation<StateType, ValueType>& explorationInformation, storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression);
                                 
-                void load(storm::generator::CompressedState const& state);
+                void load(storm::generator::CompressedState const& state, uint64_t const& thread = 0);
                 
                 std::vector<StateType> getInitialStates();
                 
-                storm::generator::StateBehavior<ValueType, StateType> expand();
+                storm::generator::StateBehavior<ValueType, StateType> expand(uint64_t const& thread = 0);
                 
                 void computeInitialStates();
                 
@@ -35,15 +43,30 @@ namespace storm {
                 
                 std::size_t getNumberOfInitialStates() const;
                 
-                bool isConditionState() const;
+                bool isConditionState(uint64_t const& thread = 0) const;
+                
+                bool isTargetState(uint64_t const& thread = 0) const;
                 
-                bool isTargetState() const;
+                /*!
+                 * Retrieves the compressed representations of the given states. This is only possible if a memory cap
+                 * is set (as only then the compressed states are stored by their index) and must only be called while
+                 * owning the mutex of the exploration information exclusively.
+                 */
+                std::vector<storm::generator::CompressedState> getCompressedStates(std::vector<StateType> const& states) const;
                 
             private:
-                storm::generator::PrismNextStateGenerator<ValueType, StateType> generator;
+                static std::vector<std::unique_ptr<storm::generator::PrismNextStateGenerator<ValueType, StateType>>> createGenerators(storm::prism::Program const& program, uint64_t numberOfGenerators);
+                
+                // One generator per sampling thread.
+                std::vector<std::unique_ptr<storm::generator::PrismNextStateGenerator<ValueType, StateType>>> generators;
                 std::function<StateType (storm::generator::CompressedState const&)> stateToIdCallback;
                 
                 storm::storage::sparse::StateStorage<StateType> stateStorage;
+                
+                // If a memory cap is set, the compressed states are also stored by their index, so that evicted states
+                // can be looked up without a pass over the state storage.
+                bool storeCompressedStates;
+                std::vector<storm::generator::CompressedState> idToState;
 
                 storm::expressions::Expression conditionStateExpression;
                 storm::expressions::Expression targetStateExpression;
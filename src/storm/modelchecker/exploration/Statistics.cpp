@@ -7,20 +7,18 @@ namespace storm {
         namespace exploration_detail {
             
             template<typename StateType, typename ValueType>
-            Statistics<StateType, ValueType>::Statistics() : pathsSampled(0), pathsSampledSinceLastPrecomputation(0), explorationSteps(0), explorationStepsSinceLastPrecomputation(0), maxPathLength(0), numberOfTargetStates(0), numberOfExploredStates(0), numberOfPrecomputations(0), ecDetections(0), failedEcDetections(0), totalNumberOfEcDetected(0) {
+            Statistics<StateType, ValueType>::Statistics() : pathsSampled(0), explorationSteps(0), maxPathLength(0), numberOfTargetStates(0), numberOfExploredStates(0), numberOfPrecomputations(0), ecDetections(0), failedEcDetections(0), totalNumberOfEcDetected(0), evictions(0), evictedConvergedStates(0), evictedUnconvergedStates(0) {
                 // Intentionally left empty.
             }
             
             template<typename StateType, typename ValueType>
             void Statistics<StateType, ValueType>::explorationStep() {
                 ++explorationSteps;
-                ++explorationStepsSinceLastPrecomputation;
             }
             
             template<typename StateType, typename ValueType>
             void Statistics<StateType, ValueType>::sampledPath() {
                 ++pathsSampled;
-                ++pathsSampledSinceLastPrecomputation;
             }
             
             template<typename StateType, typename ValueType>
@@ -28,6 +26,22 @@ namespace storm {
                 maxPathLength = std::max(maxPathLength, currentPathLength);
             }
             
+            template<typename StateType, typename ValueType>
+            void Statistics<StateType, ValueType>::add(Statistics<StateType, ValueType> const& other) {
+                pathsSampled += other.pathsSampled;
+                explorationSteps += other.explorationSteps;
+                maxPathLength = std::max(maxPathLength, other.maxPathLength);
+                numberOfTargetStates += other.numberOfTargetStates;
+                numberOfExploredStates += other.numberOfExploredStates;
+                numberOfPrecomputations += other.numberOfPrecomputations;
+                ecDetections += other.ecDetections;
+                failedEcDetections += other.failedEcDetections;
+                totalNumberOfEcDetected += other.totalNumberOfEcDetected;
+                evictions += other.evictions;
+                evictedConvergedStates += other.evictedConvergedStates;
+                evictedUnconvergedStates += other.evictedUnconvergedStates;
+            }
+            
             template<typename StateType, typename ValueType>
             void Statistics<StateType, ValueType>::printToStream(std::ostream& out, ExplorationInformation<StateType, ValueType> const& explorationInformation) const {
                 out << std::endl << "Exploration statistics:" << std::endl;
@@ -37,6 +51,9 @@ namespace storm {
                 out << "Maximal path length: " << maxPathLength << std::endl;
                 out << "Precomputations: " << numberOfPrecomputations << std::endl;
                 out << "EC detections: " << ecDetections << " (" << failedEcDetections << " failed, " << totalNumberOfEcDetected << " EC(s) detected)" << std::endl;
+                if (evictions > 0) {
+                    out << "Evictions: " << evictions << " (" << evictedConvergedStates << " converged and " << evictedUnconvergedStates << " unconverged state(s) evicted)" << std::endl;
+                }
             }
          
             template struct Statistics<uint32_t, double>;
@@ -22,12 +22,13 @@ namespace storm {
                 
                 void updateMaxPathLength(std::size_t const& currentPathLength);
                 
+                // Adds the statistics of another sampling thread to these statistics.
+                void add(Statistics<StateType, ValueType> const& other);
+                
                 void printToStream(std::ostream& out, ExplorationInformation<StateType, ValueType> const& explorationInformation) const;
                 
                 std::size_t pathsSampled;
-                std::size_t pathsSampledSinceLastPrecomputation;
                 std::size_t explorationSteps;
-                std::size_t explorationStepsSinceLastPrecomputation;
                 std::size_t maxPathLength;
                 std::size_t numberOfTargetStates;
                 std::size_t numberOfExploredStates;
@@ -35,6 +36,9 @@ namespace storm {
                 std::size_t ecDetections;
                 std::size_t failedEcDetections;
                 std::size_t totalNumberOfEcDetected;
+                std::size_t evictions;
+                std::size_t evictedConvergedStates;
+                std::size_t evictedUnconvergedStates;
             };
             
         }
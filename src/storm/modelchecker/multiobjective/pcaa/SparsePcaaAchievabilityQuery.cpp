@@ -57,9 +57,11 @@ namespace storm {
             bool SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::checkAchievability(Environment const& env) {
                 // repeatedly refine the over/ under approximation until the threshold point is either in the under approx. or not in the over approx.
                 while(!this->maxStepsPerformed(env)){
-                    WeightVector separatingVector = this->findSeparatingVector(thresholds);
-                    this->updateWeightedPrecision(separatingVector);
-                    this->performRefinementStep(env, std::move(separatingVector));
+                    std::vector<WeightVector> separatingVectors = this->findSeparatingVectors(thresholds, this->getRefinementBatchSize(env));
+                    for (uint64_t index = 0; index < separatingVectors.size(); ++index) {
+                        this->updateWeightedPrecision(separatingVectors[index], this->getWeightVectorChecker(index));
+                    }
+                    this->performRefinementSteps(env, std::move(separatingVectors));
                     if(!checkIfThresholdsAreSatisfied(this->overApproximation)){
                         return false;
                     }
@@ -72,7 +74,7 @@ namespace storm {
             }
 
             template <class SparseModelType, typename GeometryValueType>
-            void SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::updateWeightedPrecision(WeightVector const& weights) {
+            void SparsePcaaAchievabilityQuery<SparseModelType, GeometryValueType>::updateWeightedPrecision(WeightVector const& weights, PcaaWeightVectorChecker<SparseModelType>& weightVectorChecker) {
                 // Our heuristic considers the distance between the under- and the over approximation w.r.t. the given direction
                 std::pair<Point, bool> optimizationResOverApprox = this->overApproximation->optimize(weights);
                 if(optimizationResOverApprox.second) {
@@ -83,7 +85,7 @@ namespace storm {
                         // Normalize the distance by dividing it with the Euclidean Norm of the weight-vector
                         distance /= storm::utility::sqrt(storm::utility::vector::dotProduct(weights, weights));
                         distance /= GeometryValueType(2);
-                        this->weightVectorChecker->setWeightedPrecision(storm::utility::convertNumber<typename SparseModelType::ValueType>(distance));
+                        weightVectorChecker.setWeightedPrecision(storm::utility::convertNumber<typename SparseModelType::ValueType>(distance));
                     }
                 }
                 // do not update the precision if one of the approximations is unbounded in the provided direction
@@ -42,9 +42,9 @@ namespace storm {
                 bool checkAchievability(Environment const& env);
                 
                 /*
-                 * Updates the precision of the weightVectorChecker w.r.t. the provided weights
+                 * Updates the precision of the given weight vector checker w.r.t. the provided weights
                  */
-                void updateWeightedPrecision(WeightVector const& weights);
+                void updateWeightedPrecision(WeightVector const& weights, PcaaWeightVectorChecker<SparseModelType>& weightVectorChecker);
                 
                 /*
                  * Returns true iff there is one point in the given polytope that satisfies the given thresholds.
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -28,6 +30,9 @@ namespace storm {
                 // Lets be a little bit more precise to reduce the number of required iterations.
                 weightedPrecision *= storm::utility::convertNumber<typename SparseModelType::ValueType>(0.9);
                 this->weightVectorChecker->setWeightedPrecision(weightedPrecision);
+                for (auto& checker : this->additionalWeightVectorCheckers) {
+                    checker->setWeightedPrecision(weightedPrecision);
+                }
 
                 // refine the approximation
                 exploreSetOfAchievablePoints(env);
@@ -51,34 +56,44 @@ namespace storm {
             void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchievablePoints(Environment const& env) {
             
                 //First consider the objectives individually
-                for(uint_fast64_t objIndex = 0; objIndex<this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
+                std::vector<WeightVector> directions;
+                for(uint_fast64_t objIndex = 0; objIndex<this->objectives.size(); ++objIndex) {
                     WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
                     direction[objIndex] = storm::utility::one<GeometryValueType>();
-                    this->performRefinementStep(env, std::move(direction));
+                    directions.push_back(std::move(direction));
                 }
+                this->performRefinementSteps(env, std::move(directions));
                 
+                GeometryValueType precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
                 while(!this->maxStepsPerformed(env)) {
-                    // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+                    // Get the halfspaces of the underApproximation with maximal distance to a vertex of the overApproximation
                     std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
                     std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-                    uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-                    GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+                    std::vector<std::pair<uint_fast64_t, GeometryValueType>> halfspaceDistances;
                     for(uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+                        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
                         for(auto const& vertex : overApproxVertices) {
                             GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
                             if(distance > farestDistance) {
-                                farestHalfspaceIndex = halfspaceIndex;
                                 farestDistance = distance;
                             }
                         }
+                        if (farestDistance >= precision) {
+                            halfspaceDistances.emplace_back(halfspaceIndex, std::move(farestDistance));
+                        }
                     }
-                    if(farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+                    if(halfspaceDistances.empty()) {
                         // Goal precision reached!
                         return;
                     }
-                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-                    WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-                    this->performRefinementStep(env, std::move(direction));
+                    // Consider the halfspaces with the largest distance first. The sorting is stable so that among equally far halfspaces, the first one is preferred.
+                    std::stable_sort(halfspaceDistances.begin(), halfspaceDistances.end(), [] (std::pair<uint_fast64_t, GeometryValueType> const& lhs, std::pair<uint_fast64_t, GeometryValueType> const& rhs) { return lhs.second > rhs.second; });
+                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(halfspaceDistances.front().second));
+                    directions.clear();
+                    for (uint64_t index = 0; index < std::min<uint64_t>(this->getRefinementBatchSize(env), halfspaceDistances.size()); ++index) {
+                        directions.push_back(underApproxHalfspaces[halfspaceDistances[index].first].normalVector());
+                    }
+                    this->performRefinementSteps(env, std::move(directions));
                 }
                 STORM_LOG_ERROR("Could not reach the desired precision: Exceeded maximum number of refinement steps");
             }
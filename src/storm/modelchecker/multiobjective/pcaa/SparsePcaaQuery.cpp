@@ -1,5 +1,13 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
+#include <algorithm>
+#include <iterator>
+
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
@@ -10,6 +18,8 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/export.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -20,7 +30,7 @@ namespace storm {
             
             template <class SparseModelType, typename GeometryValueType>
             SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult) :
-                originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
+                originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives), preprocessorResult(preprocessorResult) {
 
                 this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
 
@@ -31,66 +41,153 @@ namespace storm {
             
             template <class SparseModelType, typename GeometryValueType>
             typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector SparsePcaaQuery<SparseModelType, GeometryValueType>::findSeparatingVector(Point const& pointToBeSeparated) {
-                STORM_LOG_DEBUG("Searching a weight vector to seperate the point given by " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(pointToBeSeparated)) << ".");
+                return findSeparatingVectors(pointToBeSeparated, 1).front();
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            std::vector<typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector> SparsePcaaQuery<SparseModelType, GeometryValueType>::findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxCount) {
+                STORM_LOG_DEBUG("Searching " << maxCount << " weight vector(s) to seperate the point given by " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(pointToBeSeparated)) << ".");
+                STORM_LOG_ASSERT(maxCount > 0, "Requested zero separating vectors.");
+                std::vector<WeightVector> result;
                 
                 if(underApproximation->isEmpty()) {
                     // In this case, every weight vector is separating
-                    uint_fast64_t objIndex = diracWeightVectorsToBeChecked.getNextSetIndex(0) % pointToBeSeparated.size();
-                    WeightVector result(pointToBeSeparated.size(), storm::utility::zero<GeometryValueType>());
-                    result[objIndex] = storm::utility::one<GeometryValueType>();
-                    diracWeightVectorsToBeChecked.set(objIndex, false);
+                    do {
+                        uint_fast64_t objIndex = diracWeightVectorsToBeChecked.getNextSetIndex(0) % pointToBeSeparated.size();
+                        WeightVector weightVector(pointToBeSeparated.size(), storm::utility::zero<GeometryValueType>());
+                        weightVector[objIndex] = storm::utility::one<GeometryValueType>();
+                        diracWeightVectorsToBeChecked.set(objIndex, false);
+                        result.push_back(std::move(weightVector));
+                    } while (result.size() < maxCount && !diracWeightVectorsToBeChecked.empty());
                     return result;
                 }
                 
-                // Reaching this point means that the underApproximation contains halfspaces. The seperating vector has to be the normal vector of one of these halfspaces.
-                // We pick one with maximal distance to the given point. However, Dirac weight vectors that only assign a non-zero weight to a single objective take precedence.
+                // Reaching this point means that the underApproximation contains halfspaces. The seperating vectors have to be the normal vectors of these halfspaces.
+                // We pick the ones with maximal distance to the given point. However, Dirac weight vectors that only assign a non-zero weight to a single objective take precedence.
                 STORM_LOG_ASSERT(!underApproximation->contains(pointToBeSeparated), "Tried to find a separating point but the point is already contained in the underApproximation");
                 std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> halfspaces = underApproximation->getHalfspaces();
-                uint_fast64_t farestHalfspaceIndex = halfspaces.size();
-                GeometryValueType farestDistance = -storm::utility::one<GeometryValueType>();
-                bool foundSeparatingDiracVector = false;
+                struct Candidate {
+                    uint_fast64_t halfspaceIndex;
+                    GeometryValueType distance;
+                    bool isSingleObjectiveVector;
+                };
+                std::vector<Candidate> candidates;
                 for(uint_fast64_t halfspaceIndex = 0; halfspaceIndex < halfspaces.size(); ++halfspaceIndex) {
                     GeometryValueType distance = halfspaces[halfspaceIndex].euclideanDistance(pointToBeSeparated);
                     if(!storm::utility::isZero(distance)) {
                         storm::storage::BitVector nonZeroVectorEntries = ~storm::utility::vector::filterZero<GeometryValueType>(halfspaces[halfspaceIndex].normalVector());
                         bool isSingleObjectiveVector = nonZeroVectorEntries.getNumberOfSetBits() == 1 && diracWeightVectorsToBeChecked.get(nonZeroVectorEntries.getNextSetIndex(0));
-                        // Check if this halfspace is a better candidate than the current one
-                        if((!foundSeparatingDiracVector && isSingleObjectiveVector ) || (foundSeparatingDiracVector==isSingleObjectiveVector && distance>farestDistance)) {
-                            foundSeparatingDiracVector = foundSeparatingDiracVector || isSingleObjectiveVector;
-                            farestHalfspaceIndex = halfspaceIndex;
-                            farestDistance = distance;
-                        }
+                        candidates.push_back({halfspaceIndex, std::move(distance), isSingleObjectiveVector});
                     }
                 }
-                if(foundSeparatingDiracVector) {
-                    diracWeightVectorsToBeChecked &= storm::utility::vector::filterZero<GeometryValueType>(halfspaces[farestHalfspaceIndex].normalVector());
-                }
+                STORM_LOG_THROW(!candidates.empty(), storm::exceptions::UnexpectedException, "There is no seperating vector.");
+                // The sorting is stable so that among equally good candidates, the first one is preferred.
+                std::stable_sort(candidates.begin(), candidates.end(), [] (Candidate const& lhs, Candidate const& rhs) {
+                    if (lhs.isSingleObjectiveVector != rhs.isSingleObjectiveVector) {
+                        return lhs.isSingleObjectiveVector;
+                    }
+                    return lhs.distance > rhs.distance;
+                });
                 
-                STORM_LOG_THROW(farestHalfspaceIndex<halfspaces.size(), storm::exceptions::UnexpectedException, "There is no seperating vector.");
-                STORM_LOG_DEBUG("Found separating  weight vector: " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(halfspaces[farestHalfspaceIndex].normalVector())) << ".");
-                return halfspaces[farestHalfspaceIndex].normalVector();
+                for (uint64_t candidateIndex = 0; candidateIndex < std::min<uint64_t>(maxCount, candidates.size()); ++candidateIndex) {
+                    auto const& normalVector = halfspaces[candidates[candidateIndex].halfspaceIndex].normalVector();
+                    if(candidates[candidateIndex].isSingleObjectiveVector) {
+                        diracWeightVectorsToBeChecked &= storm::utility::vector::filterZero<GeometryValueType>(normalVector);
+                    }
+                    STORM_LOG_DEBUG("Found separating  weight vector: " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(normalVector)) << ".");
+                    result.push_back(normalVector);
+                }
+                return result;
             }
             
             template <class SparseModelType, typename GeometryValueType>
             void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
-                // Normalize the direction vector so that the entries sum up to one
-                storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-                weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-                STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
-                RefinementStep step;
-                step.weightVector = direction;
-                step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-                step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
-                // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
-                for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-                    if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
-                        step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
-                        step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+                std::vector<WeightVector> directions;
+                directions.push_back(std::move(direction));
+                checkDirections(env, std::move(directions));
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+                auto directionIt = directions.begin();
+                while (directionIt != directions.end() && !maxStepsPerformed(env)) {
+                    uint64_t batchSize = std::min<uint64_t>(getRefinementBatchSize(env), std::distance(directionIt, directions.end()));
+                    std::vector<WeightVector> batch(std::make_move_iterator(directionIt), std::make_move_iterator(directionIt + batchSize));
+                    directionIt += batchSize;
+                    checkDirections(env, std::move(batch));
+                }
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            uint64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getRefinementBatchSize(Environment const& env) const {
+                uint64_t result = env.modelchecker().multi().getRefinementBatchSize();
+                if (env.modelchecker().multi().isMaxStepsSet()) {
+                    uint64_t maxSteps = env.modelchecker().multi().getMaxSteps();
+                    result = std::min<uint64_t>(result, maxSteps > refinementSteps.size() ? maxSteps - refinementSteps.size() : 1);
+                }
+                return std::max<uint64_t>(result, 1);
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            PcaaWeightVectorChecker<SparseModelType>& SparsePcaaQuery<SparseModelType, GeometryValueType>::getWeightVectorChecker(uint64_t index) {
+                if (index == 0) {
+                    return *weightVectorChecker;
+                }
+                while (additionalWeightVectorCheckers.size() < index) {
+                    additionalWeightVectorCheckers.push_back(WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult));
+                    additionalWeightVectorCheckers.back()->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+                }
+                return *additionalWeightVectorCheckers[index - 1];
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            void SparsePcaaQuery<SparseModelType, GeometryValueType>::checkDirections(Environment const& env, std::vector<WeightVector>&& directions) {
+                // Normalize the direction vectors so that the entries sum up to one
+                for (auto& direction : directions) {
+                    storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
+                }
+                
+                // Make sure that all required weight vector checkers exist before checking (potentially) concurrently.
+                std::vector<PcaaWeightVectorChecker<SparseModelType>*> checkers;
+                for (uint64_t index = 0; index < directions.size(); ++index) {
+                    checkers.push_back(&getWeightVectorChecker(index));
+                }
+                
+#ifdef STORM_HAVE_INTELTBB
+                if (directions.size() > 1 && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, directions.size(), 1), [&] (tbb::blocked_range<uint64_t> const& range) {
+                        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                            checkers[index]->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(directions[index]));
+                        }
+                    });
+                } else {
+                    for (uint64_t index = 0; index < directions.size(); ++index) {
+                        checkers[index]->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(directions[index]));
                     }
                 }
-                refinementSteps.push_back(std::move(step));
+#else
+                for (uint64_t index = 0; index < directions.size(); ++index) {
+                    checkers[index]->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(directions[index]));
+                }
+#endif
                 
-                updateOverApproximation();
+                for (uint64_t index = 0; index < directions.size(); ++index) {
+                    STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(checkers[index]->getUnderApproximationOfInitialStateResults())));
+                    RefinementStep step;
+                    step.weightVector = std::move(directions[index]);
+                    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checkers[index]->getUnderApproximationOfInitialStateResults());
+                    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checkers[index]->getOverApproximationOfInitialStateResults());
+                    // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
+                    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
+                        if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
+                            step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+                            step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+                        }
+                    }
+                    refinementSteps.push_back(std::move(step));
+                    
+                    updateOverApproximation();
+                }
                 updateUnderApproximation();
             }
             
@@ -64,12 +64,45 @@ namespace storm {
                  * @param pointToBeSeparated the point that is to be seperated
                  */
                 WeightVector findSeparatingVector(Point const& pointToBeSeparated);
+                
+                /*
+                 * Returns at most maxCount (but at least one) different weight vectors that separate the under approximation from the given point.
+                 * The vectors are ordered as in findSeparatingVector, i.e., the first one is the vector that findSeparatingVector would return.
+                 *
+                 * @param pointToBeSeparated the point that is to be seperated
+                 * @param maxCount the maximal number of weight vectors
+                 */
+                std::vector<WeightVector> findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxCount);
 
                 /*
                  * Refines the current result w.r.t. the given direction vector.
                  */
                 void performRefinementStep(Environment const& env, WeightVector&& direction);
                 
+                /*
+                 * Refines the current result w.r.t. the given direction vectors. The directions are processed in batches (see getRefinementBatchSize).
+                 * The i-th direction of a batch is checked using the i-th weight vector checker. If enabled, this is done concurrently.
+                 * Stops as soon as the maximum number of refinement steps has been performed.
+                 */
+                void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+                
+                /*
+                 * Returns the number of weight vectors that are to be checked in the next refinement step.
+                 * This considers the maximum number of refinement steps (as possibly specified in the settings).
+                 */
+                uint64_t getRefinementBatchSize(Environment const& env) const;
+                
+                /*
+                 * Returns the weight vector checker with the given index, where index 0 refers to the main weight vector checker.
+                 * Further checkers are created on demand and initially have the same precision as the main checker.
+                 */
+                PcaaWeightVectorChecker<SparseModelType>& getWeightVectorChecker(uint64_t index);
+                
+                /*
+                 * Checks the given (batch of) direction vectors and includes the results into the approximations.
+                 */
+                void checkDirections(Environment const& env, std::vector<WeightVector>&& directions);
+                
                 /*
                  * Updates the overapproximation after a refinement step has been performed
                  *
@@ -103,6 +136,12 @@ namespace storm {
                 
                 // The corresponding weight vector checker
                 std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+                
+                // Further weight vector checkers that are used for checking multiple weight vectors at once.
+                std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
+                
+                // The result of the preprocessing. Required to create additional weight vector checkers.
+                SparseMultiObjectivePreprocessorResult<SparseModelType> preprocessorResult;
 
                 //The results in each iteration of the algorithm
                 std::vector<RefinementStep> refinementSteps;
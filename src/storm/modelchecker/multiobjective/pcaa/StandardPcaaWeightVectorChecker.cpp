@@ -179,7 +179,8 @@ namespace storm {
                 solver->setTrackScheduler(true);
                 solver->setHasUniqueSolution(true);
                 solver->setOptimizationDirection(storm::solver::OptimizationDirection::Maximize);
-                auto req = solver->getRequirements(env, storm::solver::OptimizationDirection::Maximize);
+                bool warmStart = ecQuotient->warmStartChoices.is_initialized();
+                auto req = solver->getRequirements(env, storm::solver::OptimizationDirection::Maximize, warmStart);
                 setBoundsToSolver(*solver, req.lowerBounds(), req.upperBounds(), weightVector, objectivesWithNoUpperTimeBound, ecQuotient->matrix, ecQuotient->rowsWithSumLessOne, ecQuotient->auxChoiceValues);
                 if (solver->hasLowerBound()) {
                     req.clearLowerBounds();
@@ -190,13 +191,20 @@ namespace storm {
                 STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
                 solver->setRequirementsChecked(true);
                 
-                // Use the (0...0) vector as initial guess for the solution.
-                std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+                if (warmStart) {
+                    // The quotient did not change since the previous call. Hence, we start with the optimal scheduler of that call and use
+                    // the previous solution as initial guess. The choices are copied so that they are still available if the solver fails.
+                    solver->setInitialScheduler(std::vector<uint_fast64_t>(ecQuotient->warmStartChoices.get()));
+                } else {
+                    // Use the (0...0) vector as initial guess for the solution.
+                    std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+                }
                 
                 solver->solveEquations(env, ecQuotient->auxStateValues, ecQuotient->auxChoiceValues);
                 this->weightedResult = std::vector<ValueType>(transitionMatrix.getRowGroupCount());
                 
                 transformReducedSolutionToOriginalModel(ecQuotient->matrix, ecQuotient->auxStateValues, solver->getSchedulerChoices(), ecQuotient->ecqToOriginalChoiceMapping, ecQuotient->originalToEcqStateMapping, this->weightedResult, this->optimalChoices);
+                ecQuotient->warmStartChoices = solver->getSchedulerChoices();
             }
             
             template <class SparseModelType>
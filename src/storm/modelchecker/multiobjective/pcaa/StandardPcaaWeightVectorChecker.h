@@ -150,6 +150,9 @@ namespace storm {
                     std::vector<ValueType> auxStateValues;
                     std::vector<ValueType> auxChoiceValues;
                     
+                    // The optimal choices (w.r.t. the quotient) of the most recent unbounded weighted phase that considered this quotient (if any).
+                    // Consecutive weight vectors are typically close to each other, so these choices are used as a starting point for the next solver invocation.
+                    boost::optional<std::vector<uint_fast64_t>> warmStartChoices;
                 };
                 
                 boost::optional<EcQuotient> ecQuotient;
@@ -4,6 +4,7 @@
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/Multiplier.h"
+#include "storm/solver/HybridMultiplier.h"
 
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
@@ -119,6 +120,24 @@ namespace storm {
                 return std::unique_ptr<CheckResult>(new SymbolicQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), result.sumAbstract(model.getColumnVariables())));
             }
 
+            // Performs n matrix-vector multiplications x' = A*x + b, either directly on the symbolic matrix (if the
+            // hybrid multiplier is selected) or on its explicit representation.
+            template<storm::dd::DdType DdType, typename ValueType>
+            inline void repeatedMultiply(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& matrix, storm::dd::Odd const& odd, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) {
+                if (storm::solver::HybridMultiplier<DdType, ValueType>::isSelected(env)) {
+                    storm::solver::HybridMultiplier<DdType, ValueType> multiplier(matrix, model.getRowVariables(), model.getColumnVariables(), odd, odd);
+                    multiplier.repeatedMultiply(env, x, b, n);
+                } else {
+                    storm::utility::Stopwatch conversionWatch(true);
+                    storm::storage::SparseMatrix<ValueType> explicitMatrix = matrix.toMatrix(odd, odd);
+                    conversionWatch.stop();
+                    STORM_LOG_INFO("Converting symbolic matrix to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+                    
+                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+                    multiplier->repeatedMultiply(env, x, b, n);
+                }
+            }
+            
             template<storm::dd::DdType DdType, typename ValueType>
             std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeBoundedUntilProbabilities(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& phiStates, storm::dd::Bdd<DdType> const& psiStates, uint_fast64_t stepBound) {
                 // We need to identify the states which have to be taken out of the matrix, i.e. all states that have
@@ -155,15 +174,13 @@ namespace storm {
                     // Create the solution vector.
                     std::vector<ValueType> x(maybeStates.getNonZeroCount(), storm::utility::zero<ValueType>());
                     
-                    // Translate the symbolic matrix/vector to their explicit representations.
+                    // Translate the symbolic vector to its explicit representation.
                     conversionWatch.start();
-                    storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
                     std::vector<ValueType> b = subvector.toVector(odd);
                     conversionWatch.stop();
-                    STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+                    STORM_LOG_INFO("Converting symbolic vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitSubmatrix);
-                    multiplier->repeatedMultiply(env, x, &b, stepBound);
+                    repeatedMultiply(env, model, submatrix, odd, x, &b, stepBound);
 
                     // Return a hybrid check result that stores the numerical values explicitly.
                     return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getReachableStates() && !maybeStates, psiStates.template toAdd<ValueType>(), maybeStates, odd, x));
@@ -184,15 +201,11 @@ namespace storm {
                 
                 // Create the solution vector (and initialize it to the state rewards of the model).
                 std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
-                
-                // Translate the symbolic matrix to its explicit representations.
-                storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
                 conversionWatch.stop();
-                STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+                STORM_LOG_INFO("Converting symbolic vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Perform the matrix-vector multiplication.
-                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
-                multiplier->repeatedMultiply(env, x, nullptr, stepBound);
+                repeatedMultiply(env, model, transitionMatrix, odd, x, nullptr, stepBound);
 
                 // Return a hybrid check result that stores the numerical values explicitly.
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), odd, x));
@@ -214,15 +227,13 @@ namespace storm {
                 // Create the ODD for the translation between symbolic and explicit storage.
                 storm::dd::Odd odd = model.getReachableStates().createOdd();
                 
-                // Translate the symbolic matrix/vector to their explicit representations.
-                storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+                // Translate the symbolic vector to its explicit representation.
                 std::vector<ValueType> b = totalRewardVector.toVector(odd);
                 conversionWatch.stop();
-                STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+                STORM_LOG_INFO("Converting symbolic vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Perform the matrix-vector multiplication.
-                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
-                multiplier->repeatedMultiply(env, x, &b, stepBound);
+                repeatedMultiply(env, model, transitionMatrix, odd, x, &b, stepBound);
                 
                 // Return a hybrid check result that stores the numerical values explicitly.
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), odd, x));
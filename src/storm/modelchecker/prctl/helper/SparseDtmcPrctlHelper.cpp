@@ -17,6 +17,7 @@
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
+#include "storm/modelchecker/prctl/helper/rewardbounded/EpochAnalysis.h"
 
 #include "storm/environment/solver/SolverEnvironment.h"
 
@@ -32,6 +33,7 @@
 
 #include "storm/utility/macros.h"
 #include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/NumberTraits.h"
 
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
@@ -42,6 +44,90 @@
 namespace storm {
     namespace modelchecker {
         namespace helper {
+            /*!
+             * Tries to account for the given number of remaining iterations at once, assuming that the differences of
+             * consecutive iterates converge geometrically. As the matrix is non-negative, d' <= lambda * d (d' >= mu * d)
+             * for the last two differences d and d' implies that all further differences are bounded by the respective
+             * powers of lambda (mu). The values are only updated if the resulting interval for each state has a width of
+             * at most the given precision.
+             *
+             * @return True iff the values were updated.
+             */
+            template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::IsExact, int>::type = 0>
+            bool predictRemainingStepsGeometrically(std::vector<ValueType>&, std::vector<ValueType> const&, std::vector<ValueType> const&, uint64_t, ValueType const&) {
+                // Predictions are not exact, so we never perform them for exact value types.
+                return false;
+            }
+            
+            template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::IsExact, int>::type = 0>
+            bool predictRemainingStepsGeometrically(std::vector<ValueType>& values, std::vector<ValueType> const& previousValues, std::vector<ValueType> const& secondPreviousValues, uint64_t remainingSteps, ValueType const& precision) {
+                ValueType lambda = storm::utility::zero<ValueType>();
+                ValueType mu = storm::utility::one<ValueType>();
+                for (uint64_t state = 0; state < values.size(); ++state) {
+                    ValueType difference = values[state] - previousValues[state];
+                    ValueType previousDifference = previousValues[state] - secondPreviousValues[state];
+                    if (difference < storm::utility::zero<ValueType>() || previousDifference < storm::utility::zero<ValueType>()) {
+                        // Can only happen due to numerical inaccuracies.
+                        return false;
+                    }
+                    if (storm::utility::isZero(previousDifference)) {
+                        if (!storm::utility::isZero(difference)) {
+                            return false;
+                        }
+                        continue;
+                    }
+                    ValueType ratio = difference / previousDifference;
+                    lambda = std::max(lambda, ratio);
+                    mu = std::min(mu, ratio);
+                }
+                if (lambda >= storm::utility::one<ValueType>()) {
+                    return false;
+                }
+                
+                // Computes q + q^2 + ... + q^remainingSteps.
+                auto geometricSum = [&remainingSteps] (ValueType const& q) {
+                    return q * (storm::utility::one<ValueType>() - storm::utility::pow(q, remainingSteps)) / (storm::utility::one<ValueType>() - q);
+                };
+                ValueType upperFactor = geometricSum(lambda);
+                ValueType lowerFactor = geometricSum(std::min(mu, lambda));
+                ValueType two = storm::utility::convertNumber<ValueType>(2.0);
+                for (uint64_t state = 0; state < values.size(); ++state) {
+                    if ((values[state] - previousValues[state]) * (upperFactor - lowerFactor) > precision) {
+                        return false;
+                    }
+                }
+                ValueType factor = (upperFactor + lowerFactor) / two;
+                for (uint64_t state = 0; state < values.size(); ++state) {
+                    values[state] += (values[state] - previousValues[state]) * factor;
+                }
+                return true;
+            }
+            
+            /*!
+             * Performs the given number of iterations x' = A*x + b, but stops as soon as the values do not change any more.
+             * Moreover, for inexact value types, the remaining iterations are predicted once the values converge
+             * geometrically (up to the precision).
+             */
+            template<typename ValueType>
+            void performStepBoundedIterationsWithSteadyStateDetection(Environment const& env, storm::solver::Multiplier<ValueType> const& multiplier, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint64_t stepBound) {
+                ValueType precision = storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+                std::vector<ValueType> nextX(x.size()), previousX = x;
+                for (uint64_t step = 1; step <= stepBound; ++step) {
+                    multiplier.multiply(env, x, &b, nextX);
+                    if (nextX == x) {
+                        STORM_LOG_DEBUG("Values reached a fixed point after " << step << " of " << stepBound << " steps.");
+                        return;
+                    }
+                    if (step > 1 && step < stepBound && predictRemainingStepsGeometrically(nextX, x, previousX, stepBound - step, precision)) {
+                        STORM_LOG_DEBUG("Predicted the remaining " << (stepBound - step) << " steps after " << step << " of " << stepBound << " steps.");
+                        x = std::move(nextX);
+                        return;
+                    }
+                    std::swap(previousX, x);
+                    std::swap(x, nextX);
+                }
+            }
+            
             template<typename ValueType, typename RewardModelType>
             std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeStepBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint_fast64_t stepBound, ModelCheckerHint const& hint) {
                 std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
@@ -72,7 +158,11 @@ namespace storm {
                     
                     // Perform the matrix vector multiplication
                     auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-                    multiplier->repeatedMultiply(env, subresult, &b, stepBound);
+                    if (storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>() && storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isSteadyStateDetectionSet()) {
+                        performStepBoundedIterationsWithSteadyStateDetection(env, *multiplier, subresult, b, stepBound);
+                    } else {
+                        multiplier->repeatedMultiply(env, subresult, &b, stepBound);
+                    }
                     
                     // Set the values of the resulting vector accordingly.
                     storm::utility::vector::setVectorValues(result, maybeStates, subresult);
@@ -170,10 +260,6 @@ namespace storm {
                 auto initEpoch = rewardUnfolding.getStartEpoch();
                 auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
                 
-                // initialize data that will be needed for each epoch
-                std::vector<ValueType> x, b;
-                std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
-
                 Environment preciseEnv = env;
                 ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
                 preciseEnv.solver().setLinearEquationSolverPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
@@ -190,17 +276,7 @@ namespace storm {
                 progress.setMaxCount(epochOrder.size());
                 progress.startNewMeasurement(0);
                 uint64_t numCheckedEpochs = 0;
-                for (auto const& epoch : epochOrder) {
-                    swBuild.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    swBuild.stop(); swCheck.start();
-                    // If the epoch matrix is empty we do not need to solve a linear equation system
-                    if ((convertToEquationSystem && epochModel.epochMatrix.isIdentityMatrix()) || (!convertToEquationSystem && epochModel.epochMatrix.getEntryCount() == 0)) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(analyzeTrivialDtmcEpochModel<ValueType>(epochModel));
-                    } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(analyzeNonTrivialDtmcEpochModel<ValueType>(preciseEnv, epochModel, x, b, linEqSolver, lowerBound, upperBound));
-                    }
-                    swCheck.stop();
+                auto finishEpoch = [&] (typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
                     if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
                         std::vector<ValueType> cdfEntry;
                         for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
@@ -212,7 +288,17 @@ namespace storm {
                     }
                     ++numCheckedEpochs;
                     progress.updateProgress(numCheckedEpochs);
-                }
+                };
+                
+                auto analyzeEpochModel = [&] (typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::EpochModel& epochModel, std::vector<ValueType>& x, std::vector<ValueType>& b, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& linEqSolver) {
+                    // If the epoch matrix is empty we do not need to solve a linear equation system
+                    if ((convertToEquationSystem && epochModel.epochMatrix.isIdentityMatrix()) || (!convertToEquationSystem && epochModel.epochMatrix.getEntryCount() == 0)) {
+                        return analyzeTrivialDtmcEpochModel<ValueType>(epochModel);
+                    } else {
+                        return analyzeNonTrivialDtmcEpochModel<ValueType>(preciseEnv, epochModel, x, b, linEqSolver, lowerBound, upperBound);
+                    }
+                };
+                rewardbounded::analyzeEpochs<ValueType, storm::solver::LinearEquationSolver<ValueType>>(rewardUnfolding, epochOrder, analyzeEpochModel, finishEpoch, swBuild, swCheck);
                 
                 std::map<storm::storage::sparse::state_type, ValueType> result;
                 for (auto const& initState : model.getInitialStates()) {
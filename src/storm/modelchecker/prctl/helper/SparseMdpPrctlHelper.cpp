@@ -1,5 +1,10 @@
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 #include <boost/container/flat_map.hpp>
 
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -7,6 +12,7 @@
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
+#include "storm/modelchecker/prctl/helper/rewardbounded/EpochAnalysis.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -79,7 +85,21 @@ namespace storm {
                     std::vector<ValueType> subresult(maybeStates.getNumberOfSetBits());
                     
                     auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, submatrix);
-                    multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, stepBound);
+                    if (storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>() && storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isSteadyStateDetectionSet()) {
+                        // Stop as soon as the values do not change any more. Then, the choices made in the next step
+                        // coincide with the ones of the current step and all further steps are redundant.
+                        std::vector<ValueType> nextSubresult(subresult.size());
+                        for (uint64_t step = 1; step <= stepBound; ++step) {
+                            multiplier->multiplyAndReduce(env, goal.direction(), subresult, &b, nextSubresult);
+                            if (nextSubresult == subresult) {
+                                STORM_LOG_DEBUG("Values reached a fixed point after " << step << " of " << stepBound << " steps.");
+                                break;
+                            }
+                            std::swap(subresult, nextSubresult);
+                        }
+                    } else {
+                        multiplier->repeatedMultiplyAndReduce(env, goal.direction(), subresult, &b, stepBound);
+                    }
                     
                     // Set the values of the resulting vector accordingly.
                     storm::utility::vector::setVectorValues(result, maybeStates, subresult);
@@ -198,10 +218,6 @@ namespace storm {
                 auto initEpoch = rewardUnfolding.getStartEpoch();
                 auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
                 
-                // initialize data that will be needed for each epoch
-                std::vector<ValueType> x, b;
-                std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;
-
                 ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
                 Environment preciseEnv = env;
                 preciseEnv.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
@@ -213,17 +229,7 @@ namespace storm {
                 progress.setMaxCount(epochOrder.size());
                 progress.startNewMeasurement(0);
                 uint64_t numCheckedEpochs = 0;
-                for (auto const& epoch : epochOrder) {
-                    swBuild.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    swBuild.stop(); swCheck.start();
-                    // If the epoch matrix is empty we do not need to solve a linear equation system
-                    if (epochModel.epochMatrix.getEntryCount() == 0) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(analyzeTrivialMdpEpochModel<ValueType>(dir, epochModel));
-                    } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(analyzeNonTrivialMdpEpochModel<ValueType>(preciseEnv, dir, epochModel, x, b, minMaxSolver, lowerBound, upperBound));
-                    }
-                    swCheck.stop();
+                auto finishEpoch = [&] (typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
                     if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
                         std::vector<ValueType> cdfEntry;
                         for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
@@ -235,7 +241,17 @@ namespace storm {
                     }
                     ++numCheckedEpochs;
                     progress.updateProgress(numCheckedEpochs);
-                }
+                };
+                
+                auto analyzeEpochModel = [&] (typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::EpochModel& epochModel, std::vector<ValueType>& x, std::vector<ValueType>& b, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& minMaxSolver) {
+                    // If the epoch matrix is empty we do not need to solve a linear equation system
+                    if (epochModel.epochMatrix.getEntryCount() == 0) {
+                        return analyzeTrivialMdpEpochModel<ValueType>(dir, epochModel);
+                    } else {
+                        return analyzeNonTrivialMdpEpochModel<ValueType>(preciseEnv, dir, epochModel, x, b, minMaxSolver, lowerBound, upperBound);
+                    }
+                };
+                rewardbounded::analyzeEpochs<ValueType, storm::solver::MinMaxLinearEquationSolver<ValueType>>(rewardUnfolding, epochOrder, analyzeEpochModel, finishEpoch, swBuild, swCheck);
                 
                 std::map<storm::storage::sparse::state_type, ValueType> result;
                 for (auto const& initState : initialStates) {
@@ -1320,10 +1336,27 @@ namespace storm {
                 std::vector<uint_fast64_t> stateToMecIndexMap(transitionMatrix.getColumnCount());
                 std::vector<ValueType> lraValuesForEndComponents(mecDecomposition.size(), zero);
                 
+                // The MECs are analyzed independently of each other. With value iteration (which does not rely on an
+                // external LP solver), this can be done concurrently.
+                bool useParallelism = false;
+#ifdef STORM_HAVE_INTELTBB
+                useParallelism = mecDecomposition.size() > 1 && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() && storm::settings::getModule<storm::settings::modules::MinMaxEquationSolverSettings>().getLraMethod() == storm::solver::LraMethod::ValueIteration;
+                if (useParallelism) {
+                    OptimizationDirection dir = goal.direction();
+                    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, mecDecomposition.size()), [&] (tbb::blocked_range<uint64_t> const& range) {
+                        for (uint64_t mecIndex = range.begin(); mecIndex < range.end(); ++mecIndex) {
+                            lraValuesForEndComponents[mecIndex] = computeLraForMaximalEndComponent(env, dir, transitionMatrix, rewardModel, mecDecomposition[mecIndex]);
+                        }
+                    });
+                }
+#endif
+                
                 for (uint_fast64_t currentMecIndex = 0; currentMecIndex < mecDecomposition.size(); ++currentMecIndex) {
                     storm::storage::MaximalEndComponent const& mec = mecDecomposition[currentMecIndex];
                     
-                    lraValuesForEndComponents[currentMecIndex] = computeLraForMaximalEndComponent(env, goal.direction(), transitionMatrix, rewardModel, mec);
+                    if (!useParallelism) {
+                        lraValuesForEndComponents[currentMecIndex] = computeLraForMaximalEndComponent(env, goal.direction(), transitionMatrix, rewardModel, mec);
+                    }
                     
                     // Gather information for later use.
                     for (auto const& stateChoicesPair : mec) {
@@ -1550,12 +1583,15 @@ namespace storm {
                 STORM_LOG_ASSERT(mecTransitions.isProbabilistic(), "The MEC-Matrix is not probabilistic.");
                 
                 // start the iterations
-                ValueType precision = storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::MinMaxEquationSolverSettings>().getPrecision());
+                ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+                bool relative = env.solver().minMax().getRelativeTerminationCriterion();
+                uint64_t maxIterations = env.solver().minMax().getMaximalNumberOfIterations();
                 std::vector<ValueType> x(mecTransitions.getRowGroupCount(), storm::utility::zero<ValueType>());
                 std::vector<ValueType> xPrime = x;
                 
                 auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, mecTransitions);
                 ValueType maxDiff, minDiff;
+                uint64_t iterations = 0;
                 while (true) {
                     // Compute the obtained rewards for the next step
                     multiplier->multiplyAndReduce(env, dir, x, &choiceRewards, x);
@@ -1577,10 +1613,23 @@ namespace storm {
                         *xPrimeIt = *xIt;
                     }
 
-                    if ((maxDiff - minDiff) < precision) {
+                    // The LRA value of the MEC lies within [minDiff, maxDiff] / scalingFactor. Returning the center of this
+                    // interval is thus sound if the interval is small enough (measured in the span seminorm of x - xPrime).
+                    ValueType span = maxDiff - minDiff;
+                    ++iterations;
+                    if (relative) {
+                        if (storm::utility::isZero(span) || span <= precision * storm::utility::abs<ValueType>(maxDiff + minDiff)) {
+                            break;
+                        }
+                    } else if (span <= storm::utility::convertNumber<ValueType>(2.0) * precision * scalingFactor) {
+                        break;
+                    }
+                    if (iterations >= maxIterations) {
+                        STORM_LOG_WARN("LRA computation for MEC did not converge within " << iterations << " iterations. The result lies in [" << (minDiff / scalingFactor) << ", " << (maxDiff / scalingFactor) << "].");
                         break;
                     }
                 }
+                STORM_LOG_TRACE("LRA computation for MEC with " << mecTransitions.getRowGroupCount() << " states converged after " << iterations << " iterations.");
                 return (maxDiff + minDiff) / (storm::utility::convertNumber<ValueType>(2.0) * scalingFactor);
             }
             
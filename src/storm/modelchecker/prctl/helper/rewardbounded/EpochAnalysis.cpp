@@ -0,0 +1,115 @@
+#include "storm/modelchecker/prctl/helper/rewardbounded/EpochAnalysis.h"
+
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+            namespace rewardbounded {
+
+                template<typename ValueType, typename SolverType>
+                void analyzeEpochs(MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding, std::vector<EpochManager::Epoch> const& epochOrder, EpochModelAnalyzer<ValueType, SolverType> const& analyzeEpochModel, std::function<void(EpochManager::Epoch const&)> const& finishEpoch, storm::utility::Stopwatch& swBuild, storm::utility::Stopwatch& swCheck) {
+                    typedef typename MultiDimensionalRewardUnfolding<ValueType, true>::EpochModel EpochModel;
+
+                    // The data used to analyze epochs sequentially.
+                    std::vector<ValueType> x, b;
+                    std::unique_ptr<SolverType> solver;
+
+                    // Whether the sequential solver was built for an epoch class that was since replaced by a batch that
+                    // was analyzed concurrently.
+                    bool sequentialSolverOutdated = false;
+
+                    bool useParallelism = false;
+#ifdef STORM_HAVE_INTELTBB
+                    useParallelism = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+                    struct WorkerData {
+                        uint64_t epochClassVersion = 0;
+                        EpochModel epochModel;
+                        std::vector<ValueType> x, b;
+                        std::unique_ptr<SolverType> solver;
+                    };
+                    tbb::enumerable_thread_specific<WorkerData> workerData;
+
+                    // The version of the epoch model that the workers have to copy. Workers start without a copy, so
+                    // the first version has to differ from their initial version.
+                    uint64_t epochClassVersion = 1;
+
+                    // Whether the epoch class changed while analyzing epochs sequentially. The next batch then needs to
+                    // be copied by the workers, even if its epoch class matches the one of the last sequential epoch.
+                    bool workerModelsOutdated = false;
+#endif
+
+                    auto epochBatches = useParallelism ? rewardUnfolding.getEpochComputationBatches(epochOrder) : std::vector<std::vector<EpochManager::Epoch>>({epochOrder});
+                    for (auto const& batch : epochBatches) {
+                        if (!useParallelism || batch.size() == 1) {
+                            for (auto const& epoch : batch) {
+                                swBuild.start();
+                                EpochModel& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+#ifdef STORM_HAVE_INTELTBB
+                                workerModelsOutdated |= epochModel.epochMatrixChanged;
+#endif
+                                if (sequentialSolverOutdated) {
+                                    // The previous epochs have been analyzed by other threads.
+                                    epochModel.epochMatrixChanged = true;
+                                    sequentialSolverOutdated = false;
+                                }
+                                swBuild.stop(); swCheck.start();
+                                rewardUnfolding.setSolutionForCurrentEpoch(analyzeEpochModel(epochModel, x, b, solver));
+                                swCheck.stop();
+                                finishEpoch(epoch);
+                            }
+                        } else {
+#ifdef STORM_HAVE_INTELTBB
+                            swBuild.start();
+                            EpochModel const& batchModel = rewardUnfolding.setCurrentEpochBatch(batch);
+                            if (batchModel.epochMatrixChanged || workerModelsOutdated) {
+                                ++epochClassVersion;
+                                workerModelsOutdated = false;
+                            }
+                            swBuild.stop(); swCheck.start();
+                            std::vector<std::vector<ValueType>> batchSolutions(batch.size());
+                            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, batch.size()), [&] (tbb::blocked_range<uint64_t> const& range) {
+                                WorkerData& data = workerData.local();
+                                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                                    if (data.epochClassVersion != epochClassVersion) {
+                                        data.epochModel = batchModel;
+                                        data.epochModel.epochMatrixChanged = true;
+                                        data.epochClassVersion = epochClassVersion;
+                                    } else {
+                                        data.epochModel.epochMatrixChanged = false;
+                                    }
+                                    rewardUnfolding.setEpochSpecificData(batch[index], data.epochModel);
+                                    batchSolutions[index] = analyzeEpochModel(data.epochModel, data.x, data.b, data.solver);
+                                }
+                            });
+                            rewardUnfolding.setSolutionsForCurrentEpochBatch(std::move(batchSolutions));
+                            sequentialSolverOutdated = true;
+                            swCheck.stop();
+                            for (auto const& epoch : batch) {
+                                finishEpoch(epoch);
+                            }
+#endif
+                        }
+                    }
+                }
+
+                template void analyzeEpochs<double, storm::solver::LinearEquationSolver<double>>(MultiDimensionalRewardUnfolding<double, true>& rewardUnfolding, std::vector<EpochManager::Epoch> const& epochOrder, EpochModelAnalyzer<double, storm::solver::LinearEquationSolver<double>> const& analyzeEpochModel, std::function<void(EpochManager::Epoch const&)> const& finishEpoch, storm::utility::Stopwatch& swBuild, storm::utility::Stopwatch& swCheck);
+                template void analyzeEpochs<double, storm::solver::MinMaxLinearEquationSolver<double>>(MultiDimensionalRewardUnfolding<double, true>& rewardUnfolding, std::vector<EpochManager::Epoch> const& epochOrder, EpochModelAnalyzer<double, storm::solver::MinMaxLinearEquationSolver<double>> const& analyzeEpochModel, std::function<void(EpochManager::Epoch const&)> const& finishEpoch, storm::utility::Stopwatch& swBuild, storm::utility::Stopwatch& swCheck);
+                template void analyzeEpochs<storm::RationalNumber, storm::solver::LinearEquationSolver<storm::RationalNumber>>(MultiDimensionalRewardUnfolding<storm::RationalNumber, true>& rewardUnfolding, std::vector<EpochManager::Epoch> const& epochOrder, EpochModelAnalyzer<storm::RationalNumber, storm::solver::LinearEquationSolver<storm::RationalNumber>> const& analyzeEpochModel, std::function<void(EpochManager::Epoch const&)> const& finishEpoch, storm::utility::Stopwatch& swBuild, storm::utility::Stopwatch& swCheck);
+                template void analyzeEpochs<storm::RationalNumber, storm::solver::MinMaxLinearEquationSolver<storm::RationalNumber>>(MultiDimensionalRewardUnfolding<storm::RationalNumber, true>& rewardUnfolding, std::vector<EpochManager::Epoch> const& epochOrder, EpochModelAnalyzer<storm::RationalNumber, storm::solver::MinMaxLinearEquationSolver<storm::RationalNumber>> const& analyzeEpochModel, std::function<void(EpochManager::Epoch const&)> const& finishEpoch, storm::utility::Stopwatch& swBuild, storm::utility::Stopwatch& swCheck);
+
+            }
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
+#include "storm/utility/Stopwatch.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+            namespace rewardbounded {
+
+                /*!
+                 * A function that analyzes the given epoch model and returns the solution for the epoch. The given vectors
+                 * and the solver can be reused across calls; the solver needs to be rebuilt if the epoch matrix changed.
+                 */
+                template<typename ValueType, typename SolverType>
+                using EpochModelAnalyzer = std::function<std::vector<ValueType>(typename MultiDimensionalRewardUnfolding<ValueType, true>::EpochModel& epochModel, std::vector<ValueType>& x, std::vector<ValueType>& b, std::unique_ptr<SolverType>& solver)>;
+
+                /*!
+                 * Analyzes the given epochs in the given order and stores their solutions in the reward unfolding. If Intel
+                 * TBB is enabled, independent epochs of the same epoch class are analyzed concurrently. In this case, each
+                 * thread works on its own copy of the epoch model (and its own solver).
+                 *
+                 * @param rewardUnfolding The reward unfolding.
+                 * @param epochOrder The epochs that are to be analyzed (see MultiDimensionalRewardUnfolding::getEpochComputationOrder).
+                 * @param analyzeEpochModel The function that analyzes a single epoch model.
+                 * @param finishEpoch A function that is called (sequentially) once the solution of an epoch is available.
+                 * @param swBuild A stopwatch that measures the time for building the epoch models.
+                 * @param swCheck A stopwatch that measures the time for analyzing the epoch models.
+                 */
+                template<typename ValueType, typename SolverType>
+                void analyzeEpochs(MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding, std::vector<EpochManager::Epoch> const& epochOrder, EpochModelAnalyzer<ValueType, SolverType> const& analyzeEpochModel, std::function<void(EpochManager::Epoch const&)> const& finishEpoch, storm::utility::Stopwatch& swBuild, storm::utility::Stopwatch& swCheck);
+
+            }
+        }
+    }
+}
@@ -3,6 +3,7 @@
 #include <string>
 #include <set>
 #include <functional>
+#include <algorithm>
 
 #include "storm/utility/macros.h"
 #include "storm/logic/Formulas.h"
@@ -15,6 +16,9 @@
 
 #include "storm/transformer/EndComponentEliminator.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
 #include "storm/exceptions/NotSupportedException.h"
@@ -61,6 +65,18 @@ namespace storm {
                 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::initialize() {
                     
                     maxSolutionsStored = 0;
+                    numberOfSpilledEpochSolutions = 0;
+                    storedSolutionValues = 0;
+                    solutionUsageCounter = 0;
+                    spillFileSize = 0;
+                    freeSpillFileSegments.clear();
+                    if (storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>() && storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().isEpochSolutionMemoryLimitSet()) {
+                        if (std::is_same<ValueType, double>::value) {
+                            solutionValueLimit = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getEpochSolutionMemoryLimit() * 1024 * 1024 / sizeof(ValueType);
+                        } else {
+                            STORM_LOG_WARN("Spilling epoch solutions to disk is only supported for floating point values. The memory limit for epoch solutions is ignored.");
+                        }
+                    }
                     
                     STORM_LOG_ASSERT(!SingleObjectiveMode || (this->objectives.size() == 1), "Enabled single objective mode but there are multiple objectives.");
                     std::vector<Epoch> epochSteps;
@@ -280,9 +296,36 @@ namespace storm {
                     }
                     std::cout << std::endl;
                     */
+                    epochsToCompute = std::set<Epoch>(collectedEpochs.begin(), collectedEpochs.end());
                     return std::vector<Epoch>(collectedEpochs.begin(), collectedEpochs.end());
                 }
                 
+                template<typename ValueType, bool SingleObjectiveMode>
+                std::vector<std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>> MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationBatches(std::vector<Epoch> const& epochComputationOrder) const {
+                    std::vector<std::vector<Epoch>> result;
+                    std::set<Epoch> currentBatch;
+                    for (auto const& epoch : epochComputationOrder) {
+                        bool startNewBatch = result.empty() || !epochManager.compareEpochClass(epoch, result.back().front());
+                        if (!startNewBatch) {
+                            // The epoch can only be added to the current batch if it does not depend on an epoch of that batch.
+                            for (auto const& step : possibleEpochSteps) {
+                                Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+                                if (successorEpoch != epoch && currentBatch.count(successorEpoch) > 0) {
+                                    startNewBatch = true;
+                                    break;
+                                }
+                            }
+                        }
+                        if (startNewBatch) {
+                            result.emplace_back();
+                            currentBatch.clear();
+                        }
+                        result.back().push_back(epoch);
+                        currentBatch.insert(epoch);
+                    }
+                    return result;
+                }
+                
                 template<typename ValueType, bool SingleObjectiveMode>
                 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochModel& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
                     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
@@ -295,6 +338,57 @@ namespace storm {
                         epochModel.epochMatrixChanged = false;
                     }
                     
+                    loadSuccessorEpochSolutions(epoch);
+                    setEpochSpecificData(epoch, epochModel);
+                    
+                    assert(epochModel.objectiveRewards.size() == objectives.size());
+                    assert(epochModel.objectiveRewardFilter.size() == objectives.size());
+                    assert(epochModel.epochMatrix.getRowCount() == epochModel.stepChoices.size());
+                    assert(epochModel.stepChoices.size() == epochModel.objectiveRewards.front().size());
+                    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewards.back().size());
+                    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
+                    assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
+                    assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
+                    
+                    currentEpoch = epoch;
+                    /*
+                    std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << std::endl;
+                    std::cout << "Matrix: " << std::endl << epochModel.epochMatrix << std::endl;
+                    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << std::endl;
+                    std::cout << "steps: " << epochModel.stepChoices << std::endl;
+                    std::cout << "step solutions: ";
+                    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
+                        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
+                    }
+                    std::cout << std::endl;
+                    */
+                    return epochModel;
+                    
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochModel const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochBatch(std::vector<Epoch> const& epochs) {
+                    STORM_LOG_ASSERT(!epochs.empty(), "Tried to set an empty batch of epochs.");
+                    STORM_LOG_DEBUG("Setting model for a batch of " << epochs.size() << " epochs starting with epoch " << epochManager.toString(epochs.front()));
+                    
+                    // Check if we need to update the current epoch class
+                    if (!currentEpoch || !epochManager.compareEpochClass(epochs.front(), currentEpoch.get())) {
+                        setCurrentEpochClass(epochs.front());
+                        epochModel.epochMatrixChanged = true;
+                    } else {
+                        epochModel.epochMatrixChanged = false;
+                    }
+                    
+                    for (auto const& epoch : epochs) {
+                        loadSuccessorEpochSolutions(epoch);
+                    }
+                    currentEpochBatch = epochs;
+                    currentEpoch = epochs.front();
+                    return epochModel;
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEpochSpecificData(Epoch const& epoch, EpochModel& epochModel) const {
                     bool containsLowerBoundedObjective = false;
                     for (auto const& dimension : dimensions) {
                         if (!dimension.isUpperBounded) {
@@ -366,29 +460,6 @@ namespace storm {
                         ++stepSolIt;
                     }
                     
-                    assert(epochModel.objectiveRewards.size() == objectives.size());
-                    assert(epochModel.objectiveRewardFilter.size() == objectives.size());
-                    assert(epochModel.epochMatrix.getRowCount() == epochModel.stepChoices.size());
-                    assert(epochModel.stepChoices.size() == epochModel.objectiveRewards.front().size());
-                    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewards.back().size());
-                    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
-                    assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
-                    assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
-                    
-                    currentEpoch = epoch;
-                    /*
-                    std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << std::endl;
-                    std::cout << "Matrix: " << std::endl << epochModel.epochMatrix << std::endl;
-                    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << std::endl;
-                    std::cout << "steps: " << epochModel.stepChoices << std::endl;
-                    std::cout << "step solutions: ";
-                    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
-                        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
-                    }
-                    std::cout << std::endl;
-                    */
-                    return epochModel;
-                    
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
@@ -603,6 +674,32 @@ namespace storm {
                     return stringstream.str();
                 }
                 
+                template<typename ValueType, bool SingleObjectiveMode>
+                template<bool SO, typename std::enable_if<SO, int>::type>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::writeSolutionToSpillFile(SolutionType const& solution) {
+                    STORM_LOG_THROW(std::fwrite(&solution, sizeof(ValueType), 1, spillFile.get()) == 1, storm::exceptions::UnexpectedException, "Unable to write to the spill file for epoch solutions.");
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                template<bool SO, typename std::enable_if<!SO, int>::type>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::writeSolutionToSpillFile(SolutionType const& solution) {
+                    STORM_LOG_ASSERT(solution.size() == objectives.size(), "Unexpected size of epoch solution.");
+                    STORM_LOG_THROW(std::fwrite(solution.data(), sizeof(ValueType), solution.size(), spillFile.get()) == solution.size(), storm::exceptions::UnexpectedException, "Unable to write to the spill file for epoch solutions.");
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                template<bool SO, typename std::enable_if<SO, int>::type>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::readSolutionFromSpillFile(SolutionType& solution) {
+                    STORM_LOG_THROW(std::fread(&solution, sizeof(ValueType), 1, spillFile.get()) == 1, storm::exceptions::UnexpectedException, "Unable to read from the spill file for epoch solutions.");
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                template<bool SO, typename std::enable_if<!SO, int>::type>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::readSolutionFromSpillFile(SolutionType& solution) {
+                    solution.resize(objectives.size());
+                    STORM_LOG_THROW(std::fread(solution.data(), sizeof(ValueType), solution.size(), spillFile.get()) == solution.size(), storm::exceptions::UnexpectedException, "Unable to read from the spill file for epoch solutions.");
+                }
+                
                 template<typename ValueType, bool SingleObjectiveMode>
                 ValueType MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getRequiredEpochModelPrecision(Epoch const& startEpoch, ValueType const& precision) {
                     // if (storm::settings::getModule<storm::settings::modules::GeneralSettings>().isSoundSet()) {
@@ -719,16 +816,31 @@ namespace storm {
                 template<typename ValueType, bool SingleObjectiveMode>
                 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
                     STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+                    setSolutionForEpoch(currentEpoch.get(), std::move(inStateSolutions));
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionsForCurrentEpochBatch(std::vector<std::vector<SolutionType>>&& inStateSolutions) {
+                    STORM_LOG_ASSERT(inStateSolutions.size() == currentEpochBatch.size(), "Invalid number of epoch solutions.");
+                    for (uint64_t index = 0; index < currentEpochBatch.size(); ++index) {
+                        setSolutionForEpoch(currentEpochBatch[index], std::move(inStateSolutions[index]));
+                    }
+                    currentEpoch = currentEpochBatch.back();
+                    currentEpochBatch.clear();
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForEpoch(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions) {
                     STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
     
                     std::set<Epoch> predecessorEpochs, successorEpochs;
                     for (auto const& step : possibleEpochSteps) {
-                        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-                        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+                        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+                        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
                     }
-                    predecessorEpochs.erase(currentEpoch.get());
-                    successorEpochs.erase(currentEpoch.get());
-                    STORM_LOG_ASSERT(!predecessorEpochs.empty(), "There are no predecessors for the epoch " << epochManager.toString(currentEpoch.get()));
+                    predecessorEpochs.erase(epoch);
+                    successorEpochs.erase(epoch);
+                    STORM_LOG_ASSERT(!predecessorEpochs.empty(), "There are no predecessors for the epoch " << epochManager.toString(epoch));
                     
                     // clean up solutions that are not needed anymore
                     for (auto const& successorEpoch : successorEpochs) {
@@ -736,39 +848,210 @@ namespace storm {
                         STORM_LOG_ASSERT(successorEpochSolutionIt != epochSolutions.end(), "Solution for successor epoch does not exist (anymore).");
                         --successorEpochSolutionIt->second.count;
                         if (successorEpochSolutionIt->second.count == 0) {
+                            releaseEpochSolution(successorEpochSolutionIt->second);
                             epochSolutions.erase(successorEpochSolutionIt);
                         }
                     }
                     
                     // add the new solution
                     EpochSolution solution;
-                    solution.count = predecessorEpochs.size();
+                    if (epochsToCompute.empty()) {
+                        solution.count = predecessorEpochs.size();
+                    } else {
+                        // Only predecessors that are actually computed will ever need this solution.
+                        // Solutions with a count of zero (e.g. the one of the start epoch) are kept.
+                        solution.count = 0;
+                        for (auto const& predecessorEpoch : predecessorEpochs) {
+                            if (epochsToCompute.count(predecessorEpoch) > 0) {
+                                ++solution.count;
+                            }
+                        }
+                    }
                     solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
                     solution.solutions = std::move(inStateSolutions);
-                    epochSolutions[currentEpoch.get()] = std::move(solution);
+                    solution.lastUsage = ++solutionUsageCounter;
+                    solution.numberOfSpilledSolutions = 0;
+                    storedSolutionValues += getNumberOfValues(solution.solutions);
+                    auto existingSolutionIt = epochSolutions.find(epoch);
+                    if (existingSolutionIt != epochSolutions.end()) {
+                        // The solution of this epoch has already been computed in a previous run.
+                        releaseEpochSolution(existingSolutionIt->second);
+                        existingSolutionIt->second = std::move(solution);
+                    } else {
+                        epochSolutions.emplace(epoch, std::move(solution));
+                    }
                     
                     maxSolutionsStored = std::max((uint64_t) epochSolutions.size(), maxSolutionsStored);
+                    spillEpochSolutionsIfNecessary();
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::loadSuccessorEpochSolutions(Epoch const& epoch) {
+                    ++solutionUsageCounter;
+                    for (auto const& step : possibleEpochSteps) {
+                        Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+                        if (successorEpoch != epoch) {
+                            auto successorSolIt = epochSolutions.find(successorEpoch);
+                            if (successorSolIt != epochSolutions.end()) {
+                                successorSolIt->second.lastUsage = solutionUsageCounter;
+                                if (successorSolIt->second.spillFilePosition) {
+                                    loadEpochSolution(successorSolIt->second);
+                                }
+                            }
+                        }
+                    }
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::spillEpochSolutionsIfNecessary() {
+                    if (!solutionValueLimit || storedSolutionValues <= solutionValueLimit.get()) {
+                        return;
+                    }
                     
+                    // Spill the least recently used solutions until only three quarters of the limit are occupied.
+                    // This way, the spilling does not have to be repeated for every new solution.
+                    std::vector<std::pair<uint64_t, EpochSolution*>> candidates;
+                    for (auto& epochSolution : epochSolutions) {
+                        if (!epochSolution.second.spillFilePosition && !epochSolution.second.solutions.empty()) {
+                            candidates.emplace_back(epochSolution.second.lastUsage, &epochSolution.second);
+                        }
+                    }
+                    std::sort(candidates.begin(), candidates.end(), [] (std::pair<uint64_t, EpochSolution*> const& lhs, std::pair<uint64_t, EpochSolution*> const& rhs) { return lhs.first < rhs.first; });
+                    uint64_t targetValues = solutionValueLimit.get() / 4 * 3;
+                    for (auto& candidate : candidates) {
+                        if (storedSolutionValues <= targetValues) {
+                            break;
+                        }
+                        spillEpochSolution(*candidate.second);
+                    }
+                    STORM_LOG_DEBUG("Spilled epoch solutions to disk. Spill file uses " << spillFileSize << " bytes (" << freeSpillFileSegments.size() << " unused segments), " << storedSolutionValues << " values are kept in memory.");
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::spillEpochSolution(EpochSolution& epochSolution) {
+                    if (!spillFile) {
+                        spillFile.reset(std::tmpfile());
+                        STORM_LOG_THROW(spillFile, storm::exceptions::UnexpectedException, "Unable to create a temporary file for spilling epoch solutions.");
+                    }
+                    uint64_t numberOfValues = getNumberOfValues(epochSolution.solutions);
+                    uint64_t position = allocateSpillFileSegment(numberOfValues * sizeof(ValueType));
+                    STORM_LOG_THROW(std::fseek(spillFile.get(), static_cast<long>(position), SEEK_SET) == 0, storm::exceptions::UnexpectedException, "Unable to access the spill file for epoch solutions.");
+                    for (auto const& solution : epochSolution.solutions) {
+                        writeSolutionToSpillFile(solution);
+                    }
+                    epochSolution.spillFilePosition = position;
+                    epochSolution.numberOfSpilledSolutions = epochSolution.solutions.size();
+                    storedSolutionValues -= numberOfValues;
+                    ++numberOfSpilledEpochSolutions;
+                    // Actually release the memory.
+                    std::vector<SolutionType>().swap(epochSolution.solutions);
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::loadEpochSolution(EpochSolution& epochSolution) {
+                    STORM_LOG_ASSERT(epochSolution.spillFilePosition, "Tried to load an epoch solution that has not been spilled.");
+                    STORM_LOG_THROW(std::fseek(spillFile.get(), static_cast<long>(epochSolution.spillFilePosition.get()), SEEK_SET) == 0, storm::exceptions::UnexpectedException, "Unable to access the spill file for epoch solutions.");
+                    epochSolution.solutions.resize(epochSolution.numberOfSpilledSolutions);
+                    for (auto& solution : epochSolution.solutions) {
+                        readSolutionFromSpillFile(solution);
+                    }
+                    uint64_t numberOfValues = getNumberOfValues(epochSolution.solutions);
+                    freeSpillFileSegment(epochSolution.spillFilePosition.get(), numberOfValues * sizeof(ValueType));
+                    epochSolution.spillFilePosition = boost::none;
+                    epochSolution.numberOfSpilledSolutions = 0;
+                    storedSolutionValues += numberOfValues;
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::releaseEpochSolution(EpochSolution& epochSolution) {
+                    if (epochSolution.spillFilePosition) {
+                        uint64_t numberOfValues = SingleObjectiveMode ? epochSolution.numberOfSpilledSolutions : epochSolution.numberOfSpilledSolutions * objectives.size();
+                        freeSpillFileSegment(epochSolution.spillFilePosition.get(), numberOfValues * sizeof(ValueType));
+                        epochSolution.spillFilePosition = boost::none;
+                        epochSolution.numberOfSpilledSolutions = 0;
+                    } else {
+                        storedSolutionValues -= getNumberOfValues(epochSolution.solutions);
+                    }
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::allocateSpillFileSegment(uint64_t size) {
+                    // Take the first unused segment that is large enough.
+                    for (auto segmentIt = freeSpillFileSegments.begin(); segmentIt != freeSpillFileSegments.end(); ++segmentIt) {
+                        if (segmentIt->second >= size) {
+                            uint64_t position = segmentIt->first;
+                            uint64_t remainingSize = segmentIt->second - size;
+                            freeSpillFileSegments.erase(segmentIt);
+                            if (remainingSize > 0) {
+                                freeSpillFileSegments.emplace(position + size, remainingSize);
+                            }
+                            return position;
+                        }
+                    }
+                    
+                    // Otherwise, append the segment to the used part of the file.
+                    uint64_t position = spillFileSize;
+                    spillFileSize += size;
+                    return position;
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::freeSpillFileSegment(uint64_t position, uint64_t size) {
+                    if (size == 0) {
+                        return;
+                    }
+                    auto segmentIt = freeSpillFileSegments.emplace(position, size).first;
+                    
+                    // Merge with the succeeding segment.
+                    auto nextSegmentIt = std::next(segmentIt);
+                    if (nextSegmentIt != freeSpillFileSegments.end() && segmentIt->first + segmentIt->second == nextSegmentIt->first) {
+                        segmentIt->second += nextSegmentIt->second;
+                        freeSpillFileSegments.erase(nextSegmentIt);
+                    }
+                    
+                    // Merge with the preceding segment.
+                    if (segmentIt != freeSpillFileSegments.begin()) {
+                        auto previousSegmentIt = std::prev(segmentIt);
+                        if (previousSegmentIt->first + previousSegmentIt->second == segmentIt->first) {
+                            previousSegmentIt->second += segmentIt->second;
+                            freeSpillFileSegments.erase(segmentIt);
+                            segmentIt = previousSegmentIt;
+                        }
+                    }
+                    
+                    // An unused segment at the end shrinks the used part of the file, so that the end is overwritten next.
+                    if (segmentIt->first + segmentIt->second == spillFileSize) {
+                        spillFileSize = segmentIt->first;
+                        freeSpillFileSegments.erase(segmentIt);
+                    }
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getNumberOfValues(std::vector<SolutionType> const& solutions) const {
+                    return SingleObjectiveMode ? solutions.size() : solutions.size() * objectives.size();
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
                 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) {
                     auto epochSolutionIt = epochSolutions.find(epoch);
                     STORM_LOG_ASSERT(epochSolutionIt != epochSolutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
+                    if (epochSolutionIt->second.spillFilePosition) {
+                        loadEpochSolution(epochSolutionIt->second);
+                    }
                     auto const& epochSolution = epochSolutionIt->second;
                     STORM_LOG_ASSERT(productState < epochSolution.productStateToSolutionVectorMap->size(), "Requested solution for epoch " << epochManager.toString(epoch) << " at an unexisting product state.");
                     STORM_LOG_ASSERT((*epochSolution.productStateToSolutionVectorMap)[productState] < epochSolution.solutions.size(), "Requested solution for epoch " << epochManager.toString(epoch) << " at a state for which no solution was stored.");
                     return epochSolution.solutions[(*epochSolution.productStateToSolutionVectorMap)[productState]];
                 }
                 template<typename ValueType, bool SingleObjectiveMode>
-                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) {
+                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) const {
                     auto epochSolutionIt = solutions.find(epoch);
                     STORM_LOG_ASSERT(epochSolutionIt != solutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
                     return *epochSolutionIt->second;
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
-                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) {
+                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const {
                     STORM_LOG_ASSERT(productState < epochSolution.productStateToSolutionVectorMap->size(), "Requested solution at an unexisting product state.");
                     STORM_LOG_ASSERT((*epochSolution.productStateToSolutionVectorMap)[productState] < epochSolution.solutions.size(), "Requested solution for epoch at a state for which no solution was stored.");
                     return epochSolution.solutions[(*epochSolution.productStateToSolutionVectorMap)[productState]];
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdio>
+#include <set>
+
 #include <boost/optional.hpp>
 
 #include "storm/storage/BitVector.h"
@@ -52,8 +55,29 @@ namespace storm {
                     Epoch getStartEpoch();
                     std::vector<Epoch> getEpochComputationOrder(Epoch const& startEpoch);
                     
+                    /*!
+                     * Splits the given epoch computation order into batches of consecutive epochs such that the epochs of
+                     * a batch have the same epoch class and do not depend on each other. Hence, the epochs of a batch can
+                     * be analyzed concurrently.
+                     */
+                    std::vector<std::vector<Epoch>> getEpochComputationBatches(std::vector<Epoch> const& epochComputationOrder) const;
+                    
                     EpochModel& setCurrentEpoch(Epoch const& epoch);
                     
+                    /*!
+                     * Sets the given batch of epochs (see getEpochComputationBatches) as the current epochs and retrieves the
+                     * epoch model of their epoch class. The epoch specific data of the model, i.e., the step solutions and the
+                     * objective reward filters, have to be set for each epoch of the batch using setEpochSpecificData.
+                     */
+                    EpochModel const& setCurrentEpochBatch(std::vector<Epoch> const& epochs);
+                    
+                    /*!
+                     * Sets the step solutions and the objective reward filters of the given epoch model (a copy of the model
+                     * retrieved from setCurrentEpochBatch) for the given epoch of the current batch.
+                     * This method may be called concurrently for different epochs and models.
+                     */
+                    void setEpochSpecificData(Epoch const& epoch, EpochModel& epochModel) const;
+                    
                     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
                     
                     /*!
@@ -68,6 +92,11 @@ namespace storm {
                     boost::optional<ValueType> getLowerObjectiveBound(uint64_t objectiveIndex = 0);
                     
                     void setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions);
+                    
+                    /*!
+                     * Sets the solutions for the epochs of the current batch (in the order of the batch).
+                     */
+                    void setSolutionsForCurrentEpochBatch(std::vector<std::vector<SolutionType>>&& inStateSolutions);
                     SolutionType const& getInitialStateResult(Epoch const& epoch); // Assumes that the initial state is unique
                     SolutionType const& getInitialStateResult(Epoch const& epoch, uint64_t initialStateIndex);
                     
@@ -77,6 +106,7 @@ namespace storm {
                 private:
                 
                     void setCurrentEpochClass(Epoch const& epoch);
+                    void setSolutionForEpoch(Epoch const& epoch, std::vector<SolutionType>&& inStateSolutions);
                     void initialize();
                     
                     void initializeObjectives(std::vector<Epoch>& epochSteps);
@@ -99,15 +129,78 @@ namespace storm {
                     template<bool SO = SingleObjectiveMode, typename std::enable_if<!SO, int>::type = 0>
                     std::string solutionToString(SolutionType const& solution) const;
                     
+                    template<bool SO = SingleObjectiveMode, typename std::enable_if<SO, int>::type = 0>
+                    void writeSolutionToSpillFile(SolutionType const& solution);
+                    template<bool SO = SingleObjectiveMode, typename std::enable_if<!SO, int>::type = 0>
+                    void writeSolutionToSpillFile(SolutionType const& solution);
+                    
+                    template<bool SO = SingleObjectiveMode, typename std::enable_if<SO, int>::type = 0>
+                    void readSolutionFromSpillFile(SolutionType& solution);
+                    template<bool SO = SingleObjectiveMode, typename std::enable_if<!SO, int>::type = 0>
+                    void readSolutionFromSpillFile(SolutionType& solution);
+                    
                     SolutionType const& getStateSolution(Epoch const& epoch, uint64_t const& productState);
                     struct EpochSolution {
                         uint64_t count;
                         std::shared_ptr<std::vector<uint64_t> const> productStateToSolutionVectorMap;
                         std::vector<SolutionType> solutions;
+                        // The value of the usage counter when this solution was last needed.
+                        uint64_t lastUsage;
+                        // If the solutions have been spilled to disk, the position in the spill file and their number.
+                        boost::optional<uint64_t> spillFilePosition;
+                        uint64_t numberOfSpilledSolutions;
                     };
                     std::map<Epoch, EpochSolution> epochSolutions;
-                    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
-                    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
+                    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) const;
+                    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const;
+                    
+                    /*!
+                     * Makes sure that the solutions of the successor epochs of the given epoch are in memory.
+                     */
+                    void loadSuccessorEpochSolutions(Epoch const& epoch);
+                    
+                    /*!
+                     * Spills the least recently used epoch solutions to disk if the stored solutions exceed the memory limit.
+                     */
+                    void spillEpochSolutionsIfNecessary();
+                    void spillEpochSolution(EpochSolution& epochSolution);
+                    void loadEpochSolution(EpochSolution& epochSolution);
+                    uint64_t getNumberOfValues(std::vector<SolutionType> const& solutions) const;
+                    
+                    /*!
+                     * Releases the memory (and the part of the spill file) occupied by the given epoch solution.
+                     */
+                    void releaseEpochSolution(EpochSolution& epochSolution);
+                    
+                    /*!
+                     * Returns the position of an unused segment of the spill file with the given size (in bytes). Segments
+                     * that have been freed are reused before the file is extended.
+                     */
+                    uint64_t allocateSpillFileSegment(uint64_t size);
+                    
+                    /*!
+                     * Marks the given segment of the spill file as unused. Adjacent unused segments are merged.
+                     */
+                    void freeSpillFileSegment(uint64_t position, uint64_t size);
+                    
+                    // The maximal number of values that the epoch solutions in memory may occupy (if limited).
+                    boost::optional<uint64_t> solutionValueLimit;
+                    // The number of values currently occupied by the epoch solutions in memory.
+                    uint64_t storedSolutionValues;
+                    // A counter that is increased whenever epoch solutions are used. Used to find the least recently used ones.
+                    uint64_t solutionUsageCounter;
+                    // The (temporary) file to which epoch solutions are spilled and the size (in bytes) of its used part.
+                    std::unique_ptr<std::FILE, int(*)(std::FILE*)> spillFile{nullptr, &std::fclose};
+                    uint64_t spillFileSize;
+                    // The unused segments within the used part of the spill file, mapping their position to their size (in bytes).
+                    std::map<uint64_t, uint64_t> freeSpillFileSegments;
+                    
+                    // The epochs of the most recently computed epoch computation order. Only these epochs are considered
+                    // when counting the epochs that still need the solution of an epoch.
+                    std::set<Epoch> epochsToCompute;
+                    
+                    // The epochs of the current batch (if any).
+                    std::vector<Epoch> currentEpochBatch;
                     
                     storm::models::sparse::Model<ValueType> const& model;
                     std::vector<storm::modelchecker::multiobjective::Objective<ValueType>> objectives;
@@ -133,6 +226,7 @@ namespace storm {
                     storm::utility::Stopwatch swInit, swFindSol, swInsertSol, swSetEpoch, swSetEpochClass, swAux1, swAux2, swAux3, swAux4;
                     std::vector<uint64_t> epochModelSizes;
                     uint64_t maxSolutionsStored;
+                    uint64_t numberOfSpilledEpochSolutions;
                 };
             }
         }
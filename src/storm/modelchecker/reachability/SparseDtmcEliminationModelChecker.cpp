@@ -4,6 +4,11 @@
 #include <random>
 #include <chrono>
 
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 
 #include "storm/settings/modules/EliminationSettings.h"
@@ -23,6 +28,7 @@
 #include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
 #include "storm/solver/stateelimination/StaticStatePriorityQueue.h"
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
+#include "storm/solver/stateelimination/RationalFunctionArithmeticCache.h"
 
 #include "storm/utility/stateelimination.h"
 #include "storm/utility/graph.h"
@@ -40,6 +46,31 @@ namespace storm {
         
         using namespace storm::utility::stateelimination;
         
+        namespace {
+            /*!
+             * Retrieves whether states can be eliminated concurrently for the given value type. Values whose numbers have
+             * non-atomic reference counts (CLN numbers) must not be copied and destroyed by several threads at once.
+             */
+            template<typename ValueType>
+            bool supportsConcurrentElimination() {
+                return true;
+            }
+            
+#ifdef STORM_USE_CLN_EA
+            template<>
+            bool supportsConcurrentElimination<storm::RationalNumber>() {
+                return false;
+            }
+#endif
+            
+#ifdef STORM_USE_CLN_RF
+            template<>
+            bool supportsConcurrentElimination<storm::RationalFunction>() {
+                return false;
+            }
+#endif
+        }
+        
         template<typename SparseDtmcModelType>
         SparseDtmcEliminationModelChecker<SparseDtmcModelType>::SparseDtmcEliminationModelChecker(storm::models::sparse::Dtmc<ValueType> const& model) : SparsePropositionalModelChecker<SparseDtmcModelType>(model) {
             // Intentionally left empty.
@@ -175,6 +206,9 @@ namespace storm {
         template<typename SparseDtmcModelType>
         std::vector<typename SparseDtmcEliminationModelChecker<SparseDtmcModelType>::ValueType> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeLongRunValues(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& maybeStates, bool computeResultsForInitialStatesOnly, std::vector<ValueType>& stateValues) {
             
+            // Share the cached arithmetic results among all eliminations performed for this query.
+            storm::solver::stateelimination::ArithmeticCacheScope<ValueType> arithmeticCacheScope;
+            
             std::chrono::high_resolution_clock::time_point totalTimeStart = std::chrono::high_resolution_clock::now();
             
             // Start by decomposing the DTMC into its BSCCs.
@@ -225,7 +259,8 @@ namespace storm {
             std::vector<ValueType> averageTimeInStates(stateValues.size(), storm::utility::one<ValueType>());
             
             // First, we eliminate all states in BSCCs (except for the representative states).
-            std::shared_ptr<StatePriorityQueue> priorityQueue = createStatePriorityQueue(distanceBasedPriorities, flexibleMatrix, flexibleBackwardTransitions, stateValues, regularStatesInBsccs);
+            uint64_t predictedFillIn = 0;
+            std::shared_ptr<StatePriorityQueue> priorityQueue = createStatePriorityQueue(distanceBasedPriorities, flexibleMatrix, flexibleBackwardTransitions, stateValues, regularStatesInBsccs, &predictedFillIn);
             storm::solver::stateelimination::MultiValueStateEliminator<ValueType> stateEliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, stateValues, averageTimeInStates);
             
             while (priorityQueue->hasNext()) {
@@ -285,9 +320,11 @@ namespace storm {
             
             // We only need to eliminate the remaining states if there was some BSCC that has a non-zero value, i.e.
             // that consists of maybe states.
+            uint64_t numberOfFillInEntries = stateEliminator.getNumberOfFillInEntries();
             if (!relevantBsccs.empty()) {
-                performOrdinaryStateElimination(flexibleMatrix, flexibleBackwardTransitions, remainingStates, initialStates, computeResultsForInitialStatesOnly, stateValues, distanceBasedPriorities);
+                numberOfFillInEntries += performOrdinaryStateElimination(flexibleMatrix, flexibleBackwardTransitions, remainingStates, initialStates, computeResultsForInitialStatesOnly, stateValues, distanceBasedPriorities, predictedFillIn);
             }
+            reportFillIn(predictedFillIn, numberOfFillInEntries);
             
             std::chrono::high_resolution_clock::time_point modelCheckingEnd = std::chrono::high_resolution_clock::now();
             std::chrono::high_resolution_clock::time_point totalTimeEnd = std::chrono::high_resolution_clock::now();
@@ -598,6 +635,9 @@ namespace storm {
         
         template<typename SparseDtmcModelType>
         std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeConditionalProbabilities(Environment const& env, CheckTask<storm::logic::ConditionalFormula, ValueType> const& checkTask) {
+            // Share the cached arithmetic results among all eliminations performed for this query.
+            storm::solver::stateelimination::ArithmeticCacheScope<ValueType> arithmeticCacheScope;
+            
             storm::logic::ConditionalFormula const& conditionalFormula = checkTask.getFormula();
             
             // Retrieve the appropriate bitvectors by model checking the subformulas.
@@ -682,12 +722,13 @@ namespace storm {
             storm::storage::FlexibleSparseMatrix<ValueType> flexibleMatrix(submatrix);
             storm::storage::FlexibleSparseMatrix<ValueType> flexibleBackwardTransitions(submatrixTransposed, true);
             
-            std::shared_ptr<StatePriorityQueue> statePriorities = createStatePriorityQueue(distanceBasedPriorities, flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, statesToEliminate);
+            uint64_t predictedFillIn = 0;
+            std::shared_ptr<StatePriorityQueue> statePriorities = createStatePriorityQueue(distanceBasedPriorities, flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, statesToEliminate, &predictedFillIn);
             
             STORM_LOG_INFO("Computing conditional probilities." << std::endl);
             uint_fast64_t numberOfStatesToEliminate = statePriorities->size();
             STORM_LOG_INFO("Eliminating " << numberOfStatesToEliminate << " states using the state elimination technique." << std::endl);
-            performPrioritizedStateElimination(statePriorities, flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, this->getModel().getInitialStates(), true);
+            reportFillIn(predictedFillIn, performPrioritizedStateElimination(statePriorities, flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, this->getModel().getInitialStates(), true));
             
             storm::solver::stateelimination::ConditionalStateEliminator<ValueType> stateEliminator = storm::solver::stateelimination::ConditionalStateEliminator<ValueType>(flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, phiStates, psiStates);
             
@@ -808,9 +849,10 @@ namespace storm {
         }
         
         template<typename SparseDtmcModelType>
-        void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedStateElimination(std::shared_ptr<StatePriorityQueue>& priorityQueue, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly) {
+        uint64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedStateElimination(std::shared_ptr<StatePriorityQueue>& priorityQueue, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, std::vector<ValueType>& values, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly, std::vector<std::mutex>* backwardRowMutexes) {
             
             storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
+            stateEliminator.setTransposedRowMutexes(backwardRowMutexes);
             
             while (priorityQueue->hasNext()) {
                 storm::storage::sparse::state_type state = priorityQueue->pop();
@@ -820,34 +862,72 @@ namespace storm {
                     values[state] = storm::utility::zero<ValueType>();
                 }
 #ifdef STORM_DEV
-                STORM_LOG_ASSERT(checkConsistent(transitionMatrix, backwardTransitions), "The forward and backward transition matrices became inconsistent.");
+                // If other parts of the matrices are modified concurrently, we can not check consistency.
+                STORM_LOG_ASSERT(backwardRowMutexes || checkConsistent(transitionMatrix, backwardTransitions), "The forward and backward transition matrices became inconsistent.");
 #endif
             }
+
+            return stateEliminator.getNumberOfFillInEntries();
         }
         
         template<typename SparseDtmcModelType>
-        void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performOrdinaryStateElimination(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, storm::storage::BitVector const& subsystem, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly, std::vector<ValueType>& values, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
-            std::shared_ptr<StatePriorityQueue> statePriorities = createStatePriorityQueue(distanceBasedPriorities, transitionMatrix, backwardTransitions, values, subsystem);
+        void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::reportFillIn(uint64_t predictedFillIn, uint64_t numberOfFillInEntries) {
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet() && eliminationOrderIsFillReducing(storm::settings::getModule<storm::settings::modules::EliminationSettings>().getEliminationOrder())) {
+                STORM_PRINT_AND_LOG("Predicted fill-in of fill-reducing elimination order: " << predictedFillIn << " (undirected) transitions." << std::endl);
+                STORM_PRINT_AND_LOG("Actual fill-in of fill-reducing elimination order: " << numberOfFillInEntries << " (directed) transitions." << std::endl);
+            }
+        }
+        
+        template<typename SparseDtmcModelType>
+        uint64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performOrdinaryStateElimination(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, storm::storage::BitVector const& subsystem, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly, std::vector<ValueType>& values, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities, uint64_t& predictedFillIn) {
+            std::shared_ptr<StatePriorityQueue> statePriorities = createStatePriorityQueue(distanceBasedPriorities, transitionMatrix, backwardTransitions, values, subsystem, &predictedFillIn);
             
             std::size_t numberOfStatesToEliminate = statePriorities->size();
             STORM_LOG_DEBUG("Eliminating " << numberOfStatesToEliminate << " states using the state elimination technique." << std::endl);
-            performPrioritizedStateElimination(statePriorities, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+            uint64_t numberOfFillInEntries = performPrioritizedStateElimination(statePriorities, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
             STORM_LOG_DEBUG("Eliminated " << numberOfStatesToEliminate << " states." << std::endl);
+            return numberOfFillInEntries;
         }
         
         template<typename SparseDtmcModelType>
-        uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performHybridStateElimination(storm::storage::SparseMatrix<ValueType> const& forwardTransitions, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, storm::storage::BitVector const& subsystem, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly, std::vector<ValueType>& values, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+        uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performHybridStateElimination(storm::storage::SparseMatrix<ValueType> const& forwardTransitions, storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, storm::storage::BitVector const& subsystem, storm::storage::BitVector const& initialStates, bool computeResultsForInitialStatesOnly, std::vector<ValueType>& values, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities, uint64_t& numberOfFillInEntries, uint64_t& predictedFillIn) {
             // When using the hybrid technique, we recursively treat the SCCs up to some size.
             std::vector<storm::storage::sparse::state_type> entryStateQueue;
+            std::atomic<uint64_t> numberOfFillInEntriesOfSccs(0);
+            std::atomic<uint64_t> predictedFillInOfSccs(0);
             STORM_LOG_DEBUG("Eliminating " << subsystem.size() << " states using the hybrid elimination technique." << std::endl);
-            uint_fast64_t maximalDepth = treatScc(transitionMatrix, values, initialStates, subsystem, initialStates, forwardTransitions, backwardTransitions, false, 0, storm::settings::getModule<storm::settings::modules::EliminationSettings>().getMaximalSccSize(), entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
+            
+            // Without Intel TBB, the settings always yield a single thread (and warn about it once).
+            uint64_t numberOfThreads = storm::settings::getModule<storm::settings::modules::EliminationSettings>().getNumberOfThreads();
+            bool eliminateSubSccsConcurrently = numberOfThreads > 1;
+            if (eliminateSubSccsConcurrently && !supportsConcurrentElimination<ValueType>()) {
+                STORM_LOG_WARN("Concurrent elimination of SCCs is not supported for this value type, because its numbers have non-atomic reference counts. SCCs are eliminated sequentially.");
+                eliminateSubSccsConcurrently = false;
+            }
+            
+            uint_fast64_t maximalDepth = 0;
+            uint_fast64_t maximalSccSize = storm::settings::getModule<storm::settings::modules::EliminationSettings>().getMaximalSccSize();
+#ifdef STORM_HAVE_INTELTBB
+            if (eliminateSubSccsConcurrently) {
+                // All (nested) parallel loops of the recursion run in this arena. Hence, at most the given number of threads eliminate states.
+                tbb::task_arena arena(static_cast<int>(numberOfThreads));
+                arena.execute([&] () {
+                    maximalDepth = treatScc(transitionMatrix, values, initialStates, subsystem, initialStates, forwardTransitions, backwardTransitions, false, 0, maximalSccSize, entryStateQueue, numberOfFillInEntriesOfSccs, predictedFillInOfSccs, computeResultsForInitialStatesOnly, true, distanceBasedPriorities);
+                });
+            }
+#endif
+            if (!eliminateSubSccsConcurrently) {
+                maximalDepth = treatScc(transitionMatrix, values, initialStates, subsystem, initialStates, forwardTransitions, backwardTransitions, false, 0, maximalSccSize, entryStateQueue, numberOfFillInEntriesOfSccs, predictedFillInOfSccs, computeResultsForInitialStatesOnly, false, distanceBasedPriorities);
+            }
+            numberOfFillInEntries = numberOfFillInEntriesOfSccs;
+            predictedFillIn = predictedFillInOfSccs;
             
             // If the entry states were to be eliminated last, we need to do so now.
             if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet()) {
                 STORM_LOG_DEBUG("Eliminating " << entryStateQueue.size() << " entry states as a last step.");
                 std::vector<storm::storage::sparse::state_type> sortedStates(entryStateQueue.begin(), entryStateQueue.end());
                 std::shared_ptr<StatePriorityQueue> queuePriorities = std::make_shared<StaticStatePriorityQueue>(sortedStates);
-                performPrioritizedStateElimination(queuePriorities, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+                numberOfFillInEntries += performPrioritizedStateElimination(queuePriorities, transitionMatrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
             }
             STORM_LOG_DEBUG("Eliminated " << subsystem.size() << " states." << std::endl);
             return maximalDepth;
@@ -855,6 +935,9 @@ namespace storm {
         
         template<typename SparseDtmcModelType>
         std::vector<typename SparseDtmcEliminationModelChecker<SparseDtmcModelType>::ValueType> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeReachabilityValues(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType>& values, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates,  bool computeResultsForInitialStatesOnly, std::vector<ValueType> const& oneStepProbabilitiesToTarget) {
+            // Share the cached arithmetic results among all eliminations performed for this query.
+            storm::solver::stateelimination::ArithmeticCacheScope<ValueType> arithmeticCacheScope;
+            
             // Then, we convert the reduced matrix to a more flexible format to be able to perform state elimination more easily.
             storm::storage::FlexibleSparseMatrix<ValueType> flexibleMatrix(transitionMatrix);
             storm::storage::FlexibleSparseMatrix<ValueType> flexibleBackwardTransitions(backwardTransitions);
@@ -869,12 +952,15 @@ namespace storm {
             // Create a bit vector that represents the subsystem of states we still have to eliminate.
             storm::storage::BitVector subsystem = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
             
+            uint64_t numberOfFillInEntries = 0;
+            uint64_t predictedFillIn = 0;
             if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().getEliminationMethod() == storm::settings::modules::EliminationSettings::EliminationMethod::State) {
-                performOrdinaryStateElimination(flexibleMatrix, flexibleBackwardTransitions, subsystem, initialStates, computeResultsForInitialStatesOnly, values, distanceBasedPriorities);
+                numberOfFillInEntries = performOrdinaryStateElimination(flexibleMatrix, flexibleBackwardTransitions, subsystem, initialStates, computeResultsForInitialStatesOnly, values, distanceBasedPriorities, predictedFillIn);
             } else if (storm::settings::getModule<storm::settings::modules::EliminationSettings>().getEliminationMethod() == storm::settings::modules::EliminationSettings::EliminationMethod::Hybrid) {
-                uint64_t maximalDepth = performHybridStateElimination(transitionMatrix, flexibleMatrix, flexibleBackwardTransitions, subsystem, initialStates, computeResultsForInitialStatesOnly, values, distanceBasedPriorities);
+                uint64_t maximalDepth = performHybridStateElimination(transitionMatrix, flexibleMatrix, flexibleBackwardTransitions, subsystem, initialStates, computeResultsForInitialStatesOnly, values, distanceBasedPriorities, numberOfFillInEntries, predictedFillIn);
                 STORM_LOG_TRACE("Maximal depth of decomposition was " << maximalDepth << ".");
             }
+            reportFillIn(predictedFillIn, numberOfFillInEntries);
             
             STORM_LOG_ASSERT(flexibleMatrix.empty(), "Not all transitions were eliminated.");
             STORM_LOG_ASSERT(flexibleBackwardTransitions.empty(), "Not all transitions were eliminated.");
@@ -888,7 +974,7 @@ namespace storm {
         }
         
         template<typename SparseDtmcModelType>
-        uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, std::vector<ValueType>& values, storm::storage::BitVector const& entryStates, storm::storage::BitVector const& scc, storm::storage::BitVector const& initialStates, storm::storage::SparseMatrix<ValueType> const& forwardTransitions, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates, uint_fast64_t level, uint_fast64_t maximalSccSize, std::vector<storm::storage::sparse::state_type>& entryStateQueue, bool computeResultsForInitialStatesOnly, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities) {
+        uint_fast64_t SparseDtmcEliminationModelChecker<SparseDtmcModelType>::treatScc(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, std::vector<ValueType>& values, storm::storage::BitVector const& entryStates, storm::storage::BitVector const& scc, storm::storage::BitVector const& initialStates, storm::storage::SparseMatrix<ValueType> const& forwardTransitions, storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions, bool eliminateEntryStates, uint_fast64_t level, uint_fast64_t maximalSccSize, std::vector<storm::storage::sparse::state_type>& entryStateQueue, std::atomic<uint64_t>& numberOfFillInEntries, std::atomic<uint64_t>& predictedFillIn, bool computeResultsForInitialStatesOnly, bool eliminateSubSccsConcurrently, boost::optional<std::vector<uint_fast64_t>> const& distanceBasedPriorities, std::vector<std::mutex>* backwardRowMutexes) {
             uint_fast64_t maximalDepth = level;
             
             // If the SCCs are large enough, we try to split them further.
@@ -914,13 +1000,18 @@ namespace storm {
                     }
                 }
                 
-                std::shared_ptr<StatePriorityQueue> statePriorities = createStatePriorityQueue(distanceBasedPriorities, matrix, backwardTransitions, values, statesInTrivialSccs);
+                uint64_t predictedFillInOfTrivialSccs = 0;
+                std::shared_ptr<StatePriorityQueue> statePriorities = createStatePriorityQueue(distanceBasedPriorities, matrix, backwardTransitions, values, statesInTrivialSccs, &predictedFillInOfTrivialSccs);
+                predictedFillIn += predictedFillInOfTrivialSccs;
                 STORM_LOG_TRACE("Eliminating " << statePriorities->size() << " trivial SCCs.");
-                performPrioritizedStateElimination(statePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+                numberOfFillInEntries += performPrioritizedStateElimination(statePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly, backwardRowMutexes);
                 STORM_LOG_TRACE("Eliminated all trivial SCCs.");
                 
                 // And then recursively treat the remaining sub-SCCs.
                 STORM_LOG_TRACE("Eliminating " << remainingSccs.getNumberOfSetBits() << " remaining SCCs on level " << level << ".");
+                bool eliminateEntryStatesOfSubSccs = eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet();
+                std::vector<storm::storage::BitVector> subSccs;
+                std::vector<storm::storage::BitVector> subSccEntryStates;
                 for (auto sccIndex : remainingSccs) {
                     storm::storage::StronglyConnectedComponent const& newScc = decomposition.getBlock(sccIndex);
                     
@@ -936,16 +1027,67 @@ namespace storm {
                             }
                         }
                     }
+                    subSccs.push_back(std::move(newSccAsBitVector));
+                    subSccEntryStates.push_back(std::move(entryStates));
+                }
+                
+#ifdef STORM_HAVE_INTELTBB
+                if (eliminateSubSccsConcurrently && subSccs.size() > 1) {
+                    // All predecessors of a non-entry state of a sub-SCC belong to the same sub-SCC. Hence, the
+                    // non-entry states of different sub-SCCs can be eliminated concurrently as this only modifies the
+                    // (forward) rows of states in the same sub-SCC. The only shared data are the backward rows of
+                    // the successors outside of a sub-SCC, which are guarded by mutexes. The entry states of the
+                    // sub-SCCs, however, have predecessors in other sub-SCCs and are thus eliminated afterwards.
+                    std::unique_ptr<std::vector<std::mutex>> localBackwardRowMutexes;
+                    if (!backwardRowMutexes) {
+                        localBackwardRowMutexes = std::make_unique<std::vector<std::mutex>>(std::min<uint64_t>(matrix.getRowCount(), 4096));
+                        backwardRowMutexes = localBackwardRowMutexes.get();
+                    }
+                    
+                    std::vector<std::vector<storm::storage::sparse::state_type>> subSccEntryStateQueues(subSccs.size());
+                    std::vector<uint_fast64_t> depths(subSccs.size(), level);
+                    // This runs in the arena created by performHybridStateElimination, which bounds the number of threads.
+                    tbb::parallel_for(static_cast<uint64_t>(0), static_cast<uint64_t>(subSccs.size()), [&] (uint64_t subSccIndex) {
+                        depths[subSccIndex] = treatScc(matrix, values, subSccEntryStates[subSccIndex], subSccs[subSccIndex], initialStates, forwardTransitions, backwardTransitions, false, level + 1, maximalSccSize, subSccEntryStateQueues[subSccIndex], numberOfFillInEntries, predictedFillIn, computeResultsForInitialStatesOnly, eliminateSubSccsConcurrently, distanceBasedPriorities, backwardRowMutexes);
+                    });
+                    maximalDepth = std::max(maximalDepth, *std::max_element(depths.begin(), depths.end()));
                     
-                    // Recursively descend in SCC-hierarchy.
-                    uint_fast64_t depth = treatScc(matrix, values, entryStates, newSccAsBitVector, initialStates, forwardTransitions, backwardTransitions, eliminateEntryStates || !storm::settings::getModule<storm::settings::modules::EliminationSettings>().isEliminateEntryStatesLastSet(), level + 1, maximalSccSize, entryStateQueue, computeResultsForInitialStatesOnly, distanceBasedPriorities);
-                    maximalDepth = std::max(maximalDepth, depth);
+                    storm::storage::BitVector entryStatesOfSubSccs(matrix.getRowCount());
+                    for (auto const& subSccEntryStateQueue : subSccEntryStateQueues) {
+                        if (eliminateEntryStatesOfSubSccs) {
+                            for (auto state : subSccEntryStateQueue) {
+                                entryStatesOfSubSccs.set(state);
+                            }
+                        } else {
+                            entryStateQueue.insert(entryStateQueue.end(), subSccEntryStateQueue.begin(), subSccEntryStateQueue.end());
+                        }
+                    }
+                    if (!entryStatesOfSubSccs.empty()) {
+                        STORM_LOG_TRACE("Eliminating " << entryStatesOfSubSccs.getNumberOfSetBits() << " entry states of the sub-SCCs on level " << level << ".");
+                        std::shared_ptr<StatePriorityQueue> entryStatePriorities = createStatePriorityQueue(entryStatesOfSubSccs);
+                        numberOfFillInEntries += performPrioritizedStateElimination(entryStatePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly, backwardRowMutexes);
+                    }
+                    
+                    // The mutexes must not be used any longer if they were created locally.
+                    if (localBackwardRowMutexes) {
+                        backwardRowMutexes = nullptr;
+                    }
+                }
+#endif
+                if (!eliminateSubSccsConcurrently || subSccs.size() <= 1) {
+                    for (uint64_t subSccIndex = 0; subSccIndex < subSccs.size(); ++subSccIndex) {
+                        // Recursively descend in SCC-hierarchy.
+                        uint_fast64_t depth = treatScc(matrix, values, subSccEntryStates[subSccIndex], subSccs[subSccIndex], initialStates, forwardTransitions, backwardTransitions, eliminateEntryStatesOfSubSccs, level + 1, maximalSccSize, entryStateQueue, numberOfFillInEntries, predictedFillIn, computeResultsForInitialStatesOnly, eliminateSubSccsConcurrently, distanceBasedPriorities, backwardRowMutexes);
+                        maximalDepth = std::max(maximalDepth, depth);
+                    }
                 }
             } else {
                 // In this case, we perform simple state elimination in the current SCC.
                 STORM_LOG_TRACE("SCC of size " << scc.getNumberOfSetBits() << " is small enough to be eliminated directly.");
-                std::shared_ptr<StatePriorityQueue> statePriorities = createStatePriorityQueue(distanceBasedPriorities, matrix, backwardTransitions, values, scc & ~entryStates);
-                performPrioritizedStateElimination(statePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+                uint64_t predictedFillInOfScc = 0;
+                std::shared_ptr<StatePriorityQueue> statePriorities = createStatePriorityQueue(distanceBasedPriorities, matrix, backwardTransitions, values, scc & ~entryStates, &predictedFillInOfScc);
+                predictedFillIn += predictedFillInOfScc;
+                numberOfFillInEntries += performPrioritizedStateElimination(statePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly, backwardRowMutexes);
                 STORM_LOG_TRACE("Eliminated all states of SCC.");
             }
             
@@ -953,7 +1095,7 @@ namespace storm {
             if (eliminateEntryStates) {
                 STORM_LOG_TRACE("Finally, eliminating entry states.");
                 std::shared_ptr<StatePriorityQueue> naivePriorities = createStatePriorityQueue(entryStates);
-                performPrioritizedStateElimination(naivePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly);
+                numberOfFillInEntries += performPrioritizedStateElimination(naivePriorities, matrix, backwardTransitions, values, initialStates, computeResultsForInitialStatesOnly, backwardRowMutexes);
                 STORM_LOG_TRACE("Eliminated/added entry states.");
             } else {
                 STORM_LOG_TRACE("Finally, adding entry states to queue.");
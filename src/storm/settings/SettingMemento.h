@@ -28,6 +28,18 @@ namespace storm {
              */
             SettingMemento(modules::ModuleSettings& settings, std::string const& longOptionName, bool resetToState);
             
+            /*!
+             * Constructs a new memento for the specified option that also restores the value of one of its arguments.
+             *
+             * @param settings The settings object in which to restore the state of the option.
+             * @param longOptionName The long name of the option.
+             * @param resetToState A flag that indicates the status to which the option is to be reset upon
+             * deconstruction of this object.
+             * @param argumentName The name of the argument whose value is to be restored.
+             * @param resetToValue The value (as a string) to which the argument is to be reset.
+             */
+            SettingMemento(modules::ModuleSettings& settings, std::string const& longOptionName, bool resetToState, std::string const& argumentName, std::string const& resetToValue);
+            
             /*!
              * Destructs the memento object and resets the value of the option to its original state.
              */
@@ -42,6 +54,10 @@ namespace storm {
             
             // The state of the option before it was set.
 			bool resetToState;
+            
+            // If set, the name of the argument whose value is restored and its value before the option was set.
+            std::string const argumentName;
+            std::string const resetToValue;
         };
         
     } // namespace settings
@@ -271,6 +271,18 @@ namespace storm {
         }
         
         
+        /*!
+         * Get module in a mutable form. The type of the module is given as a template argument. This is only meant to
+         * be used for debug (and testing) purposes or very rare cases where it is necessary.
+         *
+         * @return The module.
+         */
+        template<typename SettingsType>
+        SettingsType& mutableModule() {
+            static_assert(std::is_base_of<storm::settings::modules::ModuleSettings, SettingsType>::value, "Template argument must be derived from ModuleSettings");
+            return dynamic_cast<SettingsType&>(mutableManager().getModule(SettingsType::moduleName));
+        }
+        
         /*!
          * Returns true if the given module is registered.
          *
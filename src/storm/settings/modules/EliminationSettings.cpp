@@ -1,5 +1,8 @@
 #include "storm/settings/modules/EliminationSettings.h"
 
+#include "storm-config.h"
+
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/Option.h"
 #include "storm/settings/OptionBuilder.h"
 #include "storm/settings/ArgumentBuilder.h"
@@ -18,9 +21,11 @@ namespace storm {
             const std::string EliminationSettings::entryStatesLastOptionName = "entrylast";
             const std::string EliminationSettings::maximalSccSizeOptionName = "sccsize";
             const std::string EliminationSettings::useDedicatedModelCheckerOptionName = "use-dedicated-mc";
+            const std::string EliminationSettings::useArithmeticCacheOptionName = "arithcache";
+            const std::string EliminationSettings::numberOfThreadsOptionName = "threads";
             
             EliminationSettings::EliminationSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex"};
+                std::vector<std::string> orders = {"fw", "fwrev", "bw", "bwrev", "rand", "spen", "dpen", "regex", "mindeg", "nd"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, eliminationOrderOptionName, true, "The order that is to be used for the elimination techniques.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the order in which states are chosen for elimination.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(orders)).setDefaultValueString("fwrev").build()).build());
                 
                 std::vector<std::string> methods = {"state", "hybrid"};
@@ -30,6 +35,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalSccSizeOptionName, true, "Sets the maximal size of the SCCs for which state elimination is applied.")
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("maxsize", "The maximal size of an SCC on which state elimination is applied.").setDefaultValueUnsignedInteger(20).setIsOptional(true).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, useDedicatedModelCheckerOptionName, true, "Sets whether to use the dedicated model elimination checker (only DTMCs).").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, useArithmeticCacheOptionName, true, "Sets whether to cache the results of rational function arithmetic during elimination (only parametric models).").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true, "Sets the number of threads used to eliminate independent SCCs concurrently (only hybrid elimination, requires Intel TBB). Values over CLN numbers are always eliminated sequentially.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
             
             EliminationSettings::EliminationMethod EliminationSettings::getEliminationMethod() const {
@@ -43,6 +51,11 @@ namespace storm {
                 }
             }
             
+            std::unique_ptr<storm::settings::SettingMemento> EliminationSettings::overrideEliminationMethod(EliminationMethod method) {
+                STORM_LOG_THROW(method != EliminationMethod::Scc, storm::exceptions::IllegalArgumentValueException, "Illegal elimination method selected.");
+                return this->overrideOption(eliminationMethodOptionName, "name", method == EliminationMethod::State ? "state" : "hybrid");
+            }
+            
             EliminationSettings::EliminationOrder EliminationSettings::getEliminationOrder() const {
                 std::string eliminationOrderAsString = this->getOption(eliminationOrderOptionName).getArgumentByName("name").getValueAsString();
                 if (eliminationOrderAsString == "fw") {
@@ -61,6 +74,10 @@ namespace storm {
                     return EliminationOrder::DynamicPenalty;
                 } else if (eliminationOrderAsString == "regex") {
                     return EliminationOrder::RegularExpression;
+                } else if (eliminationOrderAsString == "mindeg") {
+                    return EliminationOrder::MinimumDegree;
+                } else if (eliminationOrderAsString == "nd") {
+                    return EliminationOrder::NestedDissection;
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal elimination order selected.");
                 }
@@ -74,9 +91,40 @@ namespace storm {
                 return this->getOption(maximalSccSizeOptionName).getArgumentByName("maxsize").getValueAsUnsignedInteger();
             }
             
+            std::unique_ptr<storm::settings::SettingMemento> EliminationSettings::overrideMaximalSccSize(uint_fast64_t maximalSccSize) {
+                return this->overrideOption(maximalSccSizeOptionName, "maxsize", std::to_string(maximalSccSize));
+            }
+            
             bool EliminationSettings::isUseDedicatedModelCheckerSet() const {
                 return this->getOption(useDedicatedModelCheckerOptionName).getHasOptionBeenSet();
             }
+            
+            bool EliminationSettings::isUseArithmeticCacheSet() const {
+                return this->getOption(useArithmeticCacheOptionName).getHasOptionBeenSet();
+            }
+            
+            std::unique_ptr<storm::settings::SettingMemento> EliminationSettings::overrideUseArithmeticCacheSet(bool stateToSet) {
+                return this->overrideOption(useArithmeticCacheOptionName, stateToSet);
+            }
+            
+            uint_fast64_t EliminationSettings::getNumberOfThreads() const {
+#ifdef STORM_HAVE_INTELTBB
+                return this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+#else
+                return 1;
+#endif
+            }
+            
+            std::unique_ptr<storm::settings::SettingMemento> EliminationSettings::overrideNumberOfThreads(uint_fast64_t numberOfThreads) {
+                return this->overrideOption(numberOfThreadsOptionName, "count", std::to_string(numberOfThreads));
+            }
+            
+            bool EliminationSettings::check() const {
+#ifndef STORM_HAVE_INTELTBB
+                STORM_LOG_WARN_COND(this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger() == 1, "Concurrent elimination of SCCs requires Intel TBB. SCCs are eliminated sequentially.");
+#endif
+                return true;
+            }
         } // namespace modules
     } // namespace settings
 } // namespace storm
@@ -15,7 +15,7 @@ namespace storm {
                 /*!
                  * An enum that contains all available state elimination orders.
                  */
-                enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression };
+                enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression, MinimumDegree, NestedDissection };
 				
                 /*!
                  * An enum that contains all available elimination methods.
@@ -34,6 +34,15 @@ namespace storm {
                  */
                 EliminationMethod getEliminationMethod() const;
                 
+                /*!
+                 * Overrides the elimination method. As soon as the returned memento goes out of scope, the original
+                 * method is restored.
+                 *
+                 * @param method The elimination method to use (either state or hybrid elimination).
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideEliminationMethod(EliminationMethod method);
+                
                 /*!
                  * Retrieves the selected elimination order.
                  *
@@ -55,12 +64,56 @@ namespace storm {
                  */
                 uint_fast64_t getMaximalSccSize() const;
                 
+                /*!
+                 * Overrides the maximal size of an SCC on which state elimination is to be directly applied. As soon as
+                 * the returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param maximalSccSize The maximal size of an SCC on which state elimination is directly applied.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideMaximalSccSize(uint_fast64_t maximalSccSize);
+                
                 /*!
                  * Retrieves whether the dedicated model checker is to be used instead of the general on.
                  *
                  * @return True iff the option was set.
                  */
                 bool isUseDedicatedModelCheckerSet() const;
+                
+                /*!
+                 * Retrieves whether the results of the rational function arithmetic are to be cached during elimination.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isUseArithmeticCacheSet() const;
+                
+                /*!
+                 * Overrides the option to cache the results of rational function arithmetic by setting it to the
+                 * specified value. As soon as the returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideUseArithmeticCacheSet(bool stateToSet);
+                
+                /*!
+                 * Retrieves the number of threads used to eliminate independent SCCs concurrently. Without Intel TBB,
+                 * this is always one.
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Overrides the number of threads used to eliminate independent SCCs concurrently. As soon as the
+                 * returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param numberOfThreads The number of threads.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideNumberOfThreads(uint_fast64_t numberOfThreads);
+                
+                bool check() const override;
 				
                 const static std::string moduleName;
                 
@@ -70,6 +123,8 @@ namespace storm {
                 const static std::string entryStatesLastOptionName;
                 const static std::string maximalSccSizeOptionName;
                 const static std::string useDedicatedModelCheckerOptionName;
+                const static std::string useArithmeticCacheOptionName;
+                const static std::string numberOfThreadsOptionName;
             };
             
         } // namespace modules
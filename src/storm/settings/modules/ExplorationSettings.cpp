@@ -5,6 +5,7 @@
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Argument.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
@@ -20,6 +21,8 @@ namespace storm {
             const std::string ExplorationSettings::nextStateHeuristicOptionName = "nextstate";
             const std::string ExplorationSettings::precisionOptionName = "precision";
             const std::string ExplorationSettings::precisionOptionShortName = "eps";
+            const std::string ExplorationSettings::numberOfThreadsOptionName = "threads";
+            const std::string ExplorationSettings::memoryCapOptionName = "memorycap";
             
             ExplorationSettings::ExplorationSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> types = { "local", "global" };
@@ -32,6 +35,12 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision to achieve.").setShortName(precisionOptionShortName)
                                 .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The value to use to determine convergence.").setDefaultValueDouble(1e-06).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, numberOfThreadsOptionName, true, "Sets the number of threads that concurrently sample paths. All threads share the explored part of the state space and the bounds.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, memoryCapOptionName, true, "If set, states are evicted whenever the explored part of the model (transitions and bounds) is estimated to need more memory than the given amount. States whose bounds have met become terminal and the least often visited states are forgotten until they are reached again. The cap is soft: the storage identifying the discovered states is not counted and the explored part may exceed the cap if not enough states can be evicted.")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("mb", "The amount of memory in megabytes.").addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterValidator(0.0)).build()).build());
             }
             
             bool ExplorationSettings::isLocalPrecomputationSet() const {
@@ -86,11 +95,33 @@ namespace storm {
                 return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
             }
             
+            uint_fast64_t ExplorationSettings::getNumberOfThreads() const {
+                return this->getOption(numberOfThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            std::unique_ptr<storm::settings::SettingMemento> ExplorationSettings::overrideNumberOfThreads(uint_fast64_t numberOfThreads) {
+                return this->overrideOption(numberOfThreadsOptionName, "count", std::to_string(numberOfThreads));
+            }
+            
+            bool ExplorationSettings::isMemoryCapSet() const {
+                return this->getOption(memoryCapOptionName).getHasOptionBeenSet();
+            }
+            
+            double ExplorationSettings::getMemoryCap() const {
+                return this->getOption(memoryCapOptionName).getArgumentByName("mb").getValueAsDouble();
+            }
+            
+            std::unique_ptr<storm::settings::SettingMemento> ExplorationSettings::overrideMemoryCap(double megabytes) {
+                return this->overrideOption(memoryCapOptionName, "mb", std::to_string(megabytes));
+            }
+            
             bool ExplorationSettings::check() const {
                 bool optionsSet = this->getOption(precomputationTypeOptionName).getHasOptionBeenSet() ||
                                     this->getOption(numberOfExplorationStepsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
                                     this->getOption(numberOfSampledPathsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
-                                    this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet();
+                                    this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(numberOfThreadsOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(memoryCapOptionName).getHasOptionBeenSet();
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::settings::modules::CoreSettings::Engine::Exploration || !optionsSet, "Exploration engine is not selected, so setting options for it has no effect.");
                 return true;
             }
@@ -79,6 +79,45 @@ namespace storm {
                  */
                 double getPrecision() const;
                 
+                /*!
+                 * Retrieves the number of threads that concurrently sample paths.
+                 *
+                 * @return The number of threads that concurrently sample paths.
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Overrides the number of threads that concurrently sample paths.
+                 *
+                 * @param numberOfThreads The number of threads.
+                 * @return A memento that restores the previous setting when destroyed.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideNumberOfThreads(uint_fast64_t numberOfThreads);
+                
+                /*!
+                 * Retrieves whether the memory cap for the explored part of the model was set.
+                 *
+                 * @return True iff the memory cap was set.
+                 */
+                bool isMemoryCapSet() const;
+                
+                /*!
+                 * Retrieves the memory cap (in megabytes) for the explored part of the model. The cap is soft, i.e. the
+                 * storage of the discovered states is not counted and the cap may be exceeded if not enough states can
+                 * be evicted.
+                 *
+                 * @return The memory cap in megabytes.
+                 */
+                double getMemoryCap() const;
+                
+                /*!
+                 * Overrides the memory cap for the explored part of the model.
+                 *
+                 * @param megabytes The memory cap in megabytes.
+                 * @return A memento that restores the previous setting when destroyed.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideMemoryCap(double megabytes);
+                
                 virtual bool check() const override;
                 
                 // The name of the module.
@@ -92,6 +131,8 @@ namespace storm {
                 static const std::string nextStateHeuristicOptionName;
                 static const std::string precisionOptionName;
                 static const std::string precisionOptionShortName;
+                static const std::string numberOfThreadsOptionName;
+                static const std::string memoryCapOptionName;
             };
         } // namespace modules
     } // namespace settings
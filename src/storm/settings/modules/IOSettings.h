@@ -73,6 +73,20 @@ namespace storm {
                  */
                  std::string getExportCdfDirectory() const;
                 
+                /*!
+                 * Retrieves whether the statistics of the DD library should be exported.
+                 *
+                 * @return True iff the DD statistics are to be exported.
+                 */
+                bool isExportDdStatisticsSet() const;
+                
+                /*!
+                 * Retrieves the name of the file to which the DD statistics are exported (in JSON format).
+                 *
+                 * @return The name of the file.
+                 */
+                std::string getExportDdStatisticsFilename() const;
+                
                 /*!
                  * Retrieves whether the explicit option was set.
                  *
@@ -278,6 +292,7 @@ namespace storm {
                 static const std::string exportExplicitOptionName;
                 static const std::string exportCdfOptionName;
                 static const std::string exportCdfOptionShortName;
+                static const std::string exportDdStatisticsOptionName;
                 static const std::string explicitOptionName;
                 static const std::string explicitOptionShortName;
                 static const std::string explicitDrnOptionName;
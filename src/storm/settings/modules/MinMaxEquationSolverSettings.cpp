@@ -111,6 +111,10 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown lra solving technique '" << lraMethodString << "'.");
             }
             
+            std::unique_ptr<storm::settings::SettingMemento> MinMaxEquationSolverSettings::overrideLraMethod(storm::solver::LraMethod const& method) {
+                return this->overrideOption(lraMethodOptionName, "name", method == storm::solver::LraMethod::LinearProgramming ? "lp" : "vi");
+            }
+            
             MinMaxEquationSolverSettings::MarkovAutomatonBoundedReachabilityMethod MinMaxEquationSolverSettings::getMarkovAutomatonBoundedReachabilityMethod() const {
                 std::string techniqueAsString = this->getOption(markovAutomatonBoundedReachabilityMethodOptionName).getArgumentByName("name").getValueAsString();
                 if (techniqueAsString == "imca") {
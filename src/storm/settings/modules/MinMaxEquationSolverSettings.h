@@ -93,6 +93,15 @@ namespace storm {
                  */
                 storm::solver::LraMethod getLraMethod() const;
                 
+                /*!
+                 * Overrides the long run average method by setting it to the given method. As soon as the returned
+                 * memento goes out of scope, the original method is restored.
+                 *
+                 * @param method The long run average method to use.
+                 * @return The memento that will eventually restore the original method.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideLraMethod(storm::solver::LraMethod const& method);
+                
                 /*!
                  * Retrieves the method to be used for bounded reachability on MAs.
                  *
@@ -1,5 +1,9 @@
 #include "storm/settings/modules/ModelCheckerSettings.h"
 
+#include <algorithm>
+
+#include <boost/algorithm/string.hpp>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/Option.h"
@@ -7,6 +11,8 @@
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Argument.h"
 
+#include "storm/utility/macros.h"
+#include "storm/exceptions/IllegalArgumentValueException.h"
 
 namespace storm {
     namespace settings {
@@ -14,14 +20,72 @@ namespace storm {
             
             const std::string ModelCheckerSettings::moduleName = "modelchecker";
             const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
+            const std::string ModelCheckerSettings::timePointsOptionName = "timepoints";
+            const std::string ModelCheckerSettings::noSteadyStateDetectionOptionName = "nosteadystatedetection";
+            const std::string ModelCheckerSettings::epochSolutionMemoryLimitOptionName = "epochsolutionmemory";
 
             ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false, "If set, states with reward zero are filtered out, potentially reducing the size of the equation system").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, timePointsOptionName, false, "If given, time-bounded reachability properties P=? [phi U<=t psi] of CTMCs are evaluated for all given time points t (instead of the time bound in the property) in a single uniformization sweep. All other properties are checked as usual. Only supported by the sparse engine.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("values", "A comma-separated list of non-negative time points.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, noSteadyStateDetectionOptionName, false, "If set, the transient analysis of CTMCs and step-bounded reachability of DTMCs and MDPs always perform all iterations, even if the iterated vector already reached its steady state.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, epochSolutionMemoryLimitOptionName, false, "If given, the epoch solutions stored during the analysis of reward-bounded properties are spilled to a temporary file as soon as they occupy more than the given amount of memory.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The memory limit in MB.").build()).build());
             }
             
             bool ModelCheckerSettings::isFilterRewZeroSet() const {
                 return this->getOption(filterRewZeroOptionName).getHasOptionBeenSet();
             }
+
+            bool ModelCheckerSettings::isTimePointsSet() const {
+                return this->getOption(timePointsOptionName).getHasOptionBeenSet();
+            }
+
+            bool ModelCheckerSettings::isSteadyStateDetectionSet() const {
+                return !this->getOption(noSteadyStateDetectionOptionName).getHasOptionBeenSet();
+            }
+
+            std::unique_ptr<storm::settings::SettingMemento> ModelCheckerSettings::overrideSteadyStateDetectionSet(bool stateToSet) {
+                return this->overrideOption(noSteadyStateDetectionOptionName, !stateToSet);
+            }
+
+            bool ModelCheckerSettings::isEpochSolutionMemoryLimitSet() const {
+                return this->getOption(epochSolutionMemoryLimitOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t ModelCheckerSettings::getEpochSolutionMemoryLimit() const {
+                return this->getOption(epochSolutionMemoryLimitOptionName).getArgumentByName("mb").getValueAsUnsignedInteger();
+            }
+
+            std::unique_ptr<storm::settings::SettingMemento> ModelCheckerSettings::overrideEpochSolutionMemoryLimit(uint64_t limit) {
+                return this->overrideOption(epochSolutionMemoryLimitOptionName, "mb", std::to_string(limit));
+            }
+
+            std::vector<double> ModelCheckerSettings::getTimePoints() const {
+                std::string timePointsAsString = this->getOption(timePointsOptionName).getArgumentByName("values").getValueAsString();
+                std::vector<std::string> timePointStrings;
+                boost::split(timePointStrings, timePointsAsString, boost::is_any_of(","));
+
+                std::vector<double> result;
+                for (auto& timePointString : timePointStrings) {
+                    boost::trim(timePointString);
+                    if (timePointString.empty()) {
+                        continue;
+                    }
+                    double timePoint = 0;
+                    try {
+                        timePoint = std::stod(timePointString);
+                    } catch (std::exception const&) {
+                        STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal time point '" << timePointString << "'.");
+                    }
+                    STORM_LOG_THROW(timePoint >= 0, storm::exceptions::IllegalArgumentValueException, "Time points must be non-negative, but got " << timePoint << ".");
+                    result.push_back(timePoint);
+                }
+                STORM_LOG_THROW(!result.empty(), storm::exceptions::IllegalArgumentValueException, "Expected at least one time point.");
+                std::sort(result.begin(), result.end());
+                result.erase(std::unique(result.begin(), result.end()), result.end());
+                return result;
+            }
             
         } // namespace modules
     } // namespace settings
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 
@@ -22,12 +24,73 @@ namespace storm {
                 
                 bool isFilterRewZeroSet() const;
 
+                /*!
+                 * Retrieves whether time points for time-bounded reachability properties of CTMCs were given.
+                 *
+                 * @return True iff the time points were given.
+                 */
+                bool isTimePointsSet() const;
+
+                /*!
+                 * Retrieves the (sorted) time points at which time-bounded reachability properties of CTMCs are to be
+                 * evaluated instead of the time bound given in the property.
+                 *
+                 * @return The time points.
+                 */
+                std::vector<double> getTimePoints() const;
+
+                /*!
+                 * Retrieves whether the transient analysis of CTMCs and step-bounded reachability of DTMCs and MDPs are
+                 * to stop as soon as the iterated vector does not change (up to the precision) any more and account for
+                 * all remaining iterations at once.
+                 *
+                 * @return True iff the steady-state detection is enabled.
+                 */
+                bool isSteadyStateDetectionSet() const;
+
+                /*!
+                 * Overrides the steady-state detection by enabling or disabling it. As soon as the returned memento goes
+                 * out of scope, the original state is restored.
+                 *
+                 * @param stateToSet True iff the steady-state detection is to be enabled.
+                 * @return The memento that will eventually restore the original state of the option.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideSteadyStateDetectionSet(bool stateToSet);
+
+                /*!
+                 * Retrieves whether a memory limit for the epoch solutions stored during the analysis of reward-bounded
+                 * properties was given.
+                 *
+                 * @return True iff the limit was given.
+                 */
+                bool isEpochSolutionMemoryLimitSet() const;
+
+                /*!
+                 * Retrieves the amount of memory (in MB) that the epoch solutions stored during the analysis of
+                 * reward-bounded properties may occupy before they are spilled to disk.
+                 *
+                 * @return The memory limit in MB.
+                 */
+                uint64_t getEpochSolutionMemoryLimit() const;
+
+                /*!
+                 * Overrides the memory limit for the epoch solutions by setting it to the specified value. As soon as
+                 * the returned memento goes out of scope, the limit is unset again (if it was not given before).
+                 *
+                 * @param limit The memory limit in MB.
+                 * @return The memento that will eventually restore the original state of the option.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideEpochSolutionMemoryLimit(uint64_t limit);
+
                 // The name of the module.
                 static const std::string moduleName;
 
             private:
                 // Define the string names of the options as constants.
                 static const std::string filterRewZeroOptionName;
+                static const std::string timePointsOptionName;
+                static const std::string noSteadyStateDetectionOptionName;
+                static const std::string epochSolutionMemoryLimitOptionName;
             };
 
         } // namespace modules
@@ -3,7 +3,9 @@
 #include "storm/utility/macros.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/Option.h"
+#include "storm/settings/ArgumentBase.h"
 #include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 
 namespace storm {
@@ -58,6 +60,15 @@ namespace storm {
                 return std::unique_ptr<storm::settings::SettingMemento>(new storm::settings::SettingMemento(*this, name, currentStatus));
             }
             
+            std::unique_ptr<storm::settings::SettingMemento> ModuleSettings::overrideOption(std::string const& name, std::string const& argumentName, std::string const& value) {
+                bool currentStatus = this->isSet(name);
+                ArgumentBase& argument = this->getOption(name).getArgumentByName(argumentName);
+                std::string currentValue = argument.getValueAsString();
+                STORM_LOG_THROW(argument.setFromStringValue(value), storm::exceptions::IllegalArgumentValueException, "Unable to set value '" << value << "' of argument '" << argumentName << "' of option '" << name << "'.");
+                this->set(name);
+                return std::unique_ptr<storm::settings::SettingMemento>(new storm::settings::SettingMemento(*this, name, currentStatus, argumentName, currentValue));
+            }
+            
             bool ModuleSettings::isSet(std::string const& optionName) const {
                 return this->getOption(optionName).getHasOptionBeenSet();
             }
@@ -55,6 +55,18 @@ namespace storm {
                  */
                 std::unique_ptr<storm::settings::SettingMemento> overrideOption(std::string const& name, bool requiredStatus);
                 
+                /*!
+                 * Sets the option with the given name and sets the value of the given argument. As a result, a pointer
+                 * to an object is returned such that when the object is destroyed (i.e. the smart pointer goes out of
+                 * scope), the option is reset to its original status and the argument to its original value.
+                 *
+                 * @param name The name of the option to set.
+                 * @param argumentName The name of the argument whose value is to be set.
+                 * @param value The value (as a string) that is to be set for the argument.
+                 * @return A pointer to an object that resets the change upon destruction.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideOption(std::string const& name, std::string const& argumentName, std::string const& value);
+                
                 /*!
                  * Retrieves the name of the module to which these settings belong.
                  *
@@ -16,6 +16,7 @@ namespace storm {
             const std::string MultiObjectiveSettings::exportPlotOptionName = "exportplot";
             const std::string MultiObjectiveSettings::precisionOptionName = "precision";
             const std::string MultiObjectiveSettings::maxStepsOptionName = "maxsteps";
+            const std::string MultiObjectiveSettings::batchSizeOptionName = "batchsize";
             
             MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> methods = {"pcaa", "constraintbased"};
@@ -26,6 +27,8 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision.").setDefaultValueDouble(1e-04).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, maxStepsOptionName, true, "Aborts the computation after the given number of refinement steps (= computed pareto optimal points).")
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "the threshold for the number of refinement steps to be performed.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, batchSizeOptionName, true, "The number of weight vectors that are checked in each iteration of the Pareto curve approximation. If intel TBB is enabled, they are checked concurrently.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of weight vectors.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
             
             storm::modelchecker::multiobjective::MultiObjectiveMethod MultiObjectiveSettings::getMultiObjectiveMethod() const {
@@ -62,6 +65,10 @@ namespace storm {
                 return this->getOption(maxStepsOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
             
+            uint_fast64_t MultiObjectiveSettings::getRefinementBatchSize() const {
+                return this->getOption(batchSizeOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+            }
+            
             bool MultiObjectiveSettings::check() const {
                 std::shared_ptr<storm::settings::ArgumentValidator<std::string>> validator = ArgumentValidatorFactory::createWritableFileValidator();
                 
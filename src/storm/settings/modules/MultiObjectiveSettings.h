@@ -57,6 +57,13 @@ namespace storm {
                  */
                 uint_fast64_t getMaxSteps() const;
                 
+                /*!
+                 * Retrieves the number of weight vectors that are checked in a single refinement step.
+                 *
+                 * @return the number of weight vectors that are checked in a single refinement step.
+                 */
+                uint_fast64_t getRefinementBatchSize() const;
+                
                 
                 /*!
                  * Checks whether the settings are consistent. If they are inconsistent, an exception is thrown.
@@ -73,6 +80,7 @@ namespace storm {
 				const static std::string exportPlotOptionName;
 				const static std::string precisionOptionName;
 				const static std::string maxStepsOptionName;
+				const static std::string batchSizeOptionName;
             };
             
         } // namespace modules
@@ -15,8 +15,8 @@ namespace storm {
             const std::string MultiplierSettings::multiplierTypeOptionName = "type";
 
             MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
-                this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.")
+                std::vector<std::string> multiplierTypes = {"native", "gmmxx", "hybrid"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred. The hybrid multiplier keeps the matrix symbolic (hybrid engine only) and falls back to the native multiplier for explicit matrices.")
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplierTypes)).setDefaultValueString("gmmxx").build()).build());
                 
             }
@@ -27,6 +27,8 @@ namespace storm {
                     return storm::solver::MultiplierType::Native;
                 } else if (type == "gmmxx") {
                     return storm::solver::MultiplierType::Gmmxx;
+                } else if (type == "hybrid") {
+                    return storm::solver::MultiplierType::Hybrid;
                 }
                 
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplier type '" << type << "'.");
@@ -0,0 +1,79 @@
+#include "storm/solver/HybridMultiplier.h"
+
+#include "storm-config.h"
+
+#include "storm/storage/dd/DdManager.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/solver/SolverSelectionOptions.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace solver {
+        
+        template<storm::dd::DdType DdType, typename ValueType>
+        HybridMultiplier<DdType, ValueType>::HybridMultiplier(storm::dd::Add<DdType, ValueType> const& matrix, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) : matrix(matrix), rowOdd(rowOdd), columnOdd(columnOdd), ddRowVariableIndices(matrix.getDdManager().getSortedVariableIndices(rowMetaVariables)), ddColumnVariableIndices(matrix.getDdManager().getSortedVariableIndices(columnMetaVariables)) {
+            STORM_LOG_THROW(ddRowVariableIndices.size() == ddColumnVariableIndices.size(), storm::exceptions::InvalidArgumentException, "The hybrid multiplier requires the same number of row and column variables.");
+        }
+        
+        template<storm::dd::DdType DdType, typename ValueType>
+        bool HybridMultiplier<DdType, ValueType>::isSelected(Environment const& env) {
+            return env.solver().multiplier().getType() == MultiplierType::Hybrid;
+        }
+        
+        template<storm::dd::DdType DdType, typename ValueType>
+        void HybridMultiplier<DdType, ValueType>::clearCache() const {
+            cachedVector.reset();
+        }
+        
+        template<storm::dd::DdType DdType, typename ValueType>
+        void HybridMultiplier<DdType, ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (cachedVector) {
+                    cachedVector->resize(rowOdd.getTotalOffset());
+                } else {
+                    cachedVector = std::make_unique<std::vector<ValueType>>(rowOdd.getTotalOffset());
+                }
+                target = cachedVector.get();
+            } else {
+                target->resize(rowOdd.getTotalOffset());
+            }
+            
+            // Initialize the target with the offset vector (if any), because the symbolic multiplication adds to it.
+            if (b) {
+                std::copy(b->begin(), b->end(), target->begin());
+            } else {
+                std::fill(target->begin(), target->end(), storm::utility::zero<ValueType>());
+            }
+            matrix.multiplyWithExplicitVector(x, *target, ddRowVariableIndices, ddColumnVariableIndices, rowOdd, columnOdd);
+            
+            if (&x == &result) {
+                std::swap(result, *cachedVector);
+            }
+        }
+        
+        template<storm::dd::DdType DdType, typename ValueType>
+        void HybridMultiplier<DdType, ValueType>::repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const {
+            for (uint64_t i = 0; i < n; ++i) {
+                multiply(env, x, b, x);
+            }
+        }
+        
+        template class HybridMultiplier<storm::dd::DdType::CUDD, double>;
+        template class HybridMultiplier<storm::dd::DdType::Sylvan, double>;
+        
+#ifdef STORM_HAVE_CARL
+        template class HybridMultiplier<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+        template class HybridMultiplier<storm::dd::DdType::Sylvan, storm::RationalFunction>;
+#endif
+        
+    }
+}
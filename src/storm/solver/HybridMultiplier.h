@@ -0,0 +1,90 @@
+#pragma once
+
+#include <vector>
+#include <set>
+#include <memory>
+
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Odd.h"
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    
+    class Environment;
+    
+    namespace solver {
+        
+        /*!
+         * A multiplier that keeps the matrix in its symbolic (MTBDD) representation, but operates on explicit vectors
+         * whose entries are mapped to the rows and columns of the matrix via offset-labeled DDs (ODDs). This avoids
+         * translating the matrix to an explicit representation while still iterating on explicit vectors.
+         */
+        template<storm::dd::DdType DdType, typename ValueType>
+        class HybridMultiplier {
+        public:
+            /*!
+             * Creates a multiplier for the given symbolic matrix.
+             *
+             * @param matrix The symbolic matrix. Note that the multiplier stores references to the matrix and the ODDs.
+             * @param rowMetaVariables The meta variables that encode the rows of the matrix.
+             * @param columnMetaVariables The meta variables that encode the columns of the matrix.
+             * @param rowOdd The ODD used for translating rows to positions in the explicit vectors.
+             * @param columnOdd The ODD used for translating columns to positions in the explicit vectors.
+             */
+            HybridMultiplier(storm::dd::Add<DdType, ValueType> const& matrix, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd);
+            
+            /*!
+             * Retrieves whether the hybrid multiplier is selected in the given environment.
+             */
+            static bool isSelected(Environment const& env);
+            
+            /*
+             * Clears the currently cached data of this multiplier in order to free some memory.
+             */
+            void clearCache() const;
+            
+            /*!
+             * Performs a matrix-vector multiplication x' = A*x + b.
+             *
+             * @param x The input vector with which to multiply the matrix. Its length must be equal
+             * to the number of columns of A.
+             * @param b If non-null, this vector is added after the multiplication. If given, its length must be equal
+             * to the number of rows of A.
+             * @param result The target vector into which to write the multiplication result. Its length must be equal
+             * to the number of rows of A. Can be the same as the x vector.
+             */
+            void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            
+            /*!
+             * Performs repeated matrix-vector multiplication, using x[0] = x and x[i + 1] = A*x[i] + b. After
+             * performing the necessary multiplications, the result is written to the input vector x. Note that the
+             * matrix A has to be given upon construction time of the multiplier object.
+             *
+             * @param x The initial vector with which to perform matrix-vector multiplication. Its length must be equal
+             * to the number of columns of A.
+             * @param b If non-null, this vector is added after each multiplication. If given, its length must be equal
+             * to the number of rows of A.
+             * @param n The number of times to perform the multiplication.
+             */
+            void repeatedMultiply(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, uint64_t n) const;
+            
+        private:
+            // The symbolic matrix.
+            storm::dd::Add<DdType, ValueType> const& matrix;
+            
+            // The ODDs used to translate between rows/columns and positions in the explicit vectors.
+            storm::dd::Odd const& rowOdd;
+            storm::dd::Odd const& columnOdd;
+            
+            // The sorted indices of the DD variables encoding rows and columns, respectively.
+            std::vector<uint_fast64_t> ddRowVariableIndices;
+            std::vector<uint_fast64_t> ddColumnVariableIndices;
+            
+            // A vector used for multiplications in which input and output vector coincide.
+            mutable std::unique_ptr<std::vector<ValueType>> cachedVector;
+        };
+        
+    }
+}
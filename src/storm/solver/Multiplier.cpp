@@ -78,6 +78,9 @@ namespace storm {
                     return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
                 case MultiplierType::Native:
                     return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+                case MultiplierType::Hybrid:
+                    // The hybrid multiplier operates on symbolic matrices, so we use the native one for explicit matrices.
+                    return std::make_unique<NativeMultiplier<ValueType>>(matrix);
             }
         }
         
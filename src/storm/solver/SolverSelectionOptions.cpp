@@ -30,6 +30,8 @@ namespace storm {
                     return "Native";
                 case MultiplierType::Gmmxx:
                     return "Gmmxx";
+                case MultiplierType::Hybrid:
+                    return "Hybrid";
             }
             return "invalid";
         }
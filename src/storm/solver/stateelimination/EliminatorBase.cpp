@@ -1,5 +1,12 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <algorithm>
+
+#include "storm/solver/stateelimination/RationalFunctionArithmeticCache.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/EliminationSettings.h"
+
 #include "storm/utility/stateelimination.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
@@ -11,10 +18,50 @@ namespace storm {
         namespace stateelimination {
             
             using namespace storm::utility::stateelimination;
+            
+            namespace detail {
+                template<typename ValueType>
+                ValueType multiply(ValueType const& first, ValueType const& second, bool) {
+                    return storm::utility::simplify((ValueType) (first * second));
+                }
+                
+                template<typename ValueType>
+                ValueType add(ValueType const& first, ValueType const& second, bool) {
+                    return storm::utility::simplify((ValueType) (first + second));
+                }
+                
+                template<typename ValueType>
+                ValueType divideOneMinus(ValueType const& value, bool) {
+                    return storm::utility::simplify((ValueType) (storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - value)));
+                }
+                
+#ifdef STORM_HAVE_CARL
+                storm::RationalFunction multiply(storm::RationalFunction const& first, storm::RationalFunction const& second, bool useCache) {
+                    if (useCache) {
+                        return RationalFunctionArithmeticCache::getInstance().multiply(first, second);
+                    }
+                    return storm::utility::simplify((storm::RationalFunction) (first * second));
+                }
+                
+                storm::RationalFunction add(storm::RationalFunction const& first, storm::RationalFunction const& second, bool useCache) {
+                    if (useCache) {
+                        return RationalFunctionArithmeticCache::getInstance().add(first, second);
+                    }
+                    return storm::utility::simplify((storm::RationalFunction) (first + second));
+                }
+                
+                storm::RationalFunction divideOneMinus(storm::RationalFunction const& value, bool useCache) {
+                    if (useCache) {
+                        return RationalFunctionArithmeticCache::getInstance().divideOneMinus(value);
+                    }
+                    return storm::utility::simplify((storm::RationalFunction) (storm::utility::one<storm::RationalFunction>() / (storm::utility::one<storm::RationalFunction>() - value)));
+                }
+#endif
+            }
 
             template<typename ValueType, ScalingMode Mode>
-            EliminatorBase<ValueType, Mode>::EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix) : matrix(matrix), transposedMatrix(transposedMatrix) {
-                // Intentionally left empty.
+            EliminatorBase<ValueType, Mode>::EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix) : matrix(matrix), transposedMatrix(transposedMatrix), numberOfFillInEntries(0), transposedRowMutexes(nullptr) {
+                useArithmeticCache = storm::settings::hasModule<storm::settings::modules::EliminationSettings>() && storm::settings::getModule<storm::settings::modules::EliminationSettings>().isUseArithmeticCacheSet();
             }
             
             template<typename ValueType, ScalingMode Mode>
@@ -49,8 +96,7 @@ namespace storm {
                 } else if (Mode == ScalingMode::DivideOneMinus) {
                     if (hasEntryInColumn) {
                         STORM_LOG_ASSERT(columnValue != storm::utility::one<ValueType>(), "The scaling mode 'divide-one-minus' requires a non-one value in the given column.");
-                        columnValue = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - columnValue);
-                        columnValue = storm::utility::simplify(columnValue);
+                        columnValue = divideOneMinus(columnValue);
                     }
                 }
                 
@@ -58,7 +104,7 @@ namespace storm {
                     for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
                         // Only scale the entries in a different column.
                         if (entryIt->getColumn() != column) {
-                            entryIt->setValue(storm::utility::simplify((ValueType) (entryIt->getValue() * columnValue)));
+                            entryIt->setValue(multiply(entryIt->getValue(), columnValue));
                         }
                     }
                     updateValue(row, columnValue);
@@ -72,10 +118,14 @@ namespace storm {
                 FlexibleRowType rowsKeepingEntryInColumnEqualRow;
                 
                 // For each entry in the row d, we need to build a list of other rows that will contain an element in the
-                // column d.
-                std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
-                for (auto& backwardEntry : newBackwardEntries) {
-                    backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
+                // column d. We reuse the lists (and their memory) across eliminations.
+                uint_fast64_t numberOfSubstitutedEntries = std::count_if(entriesInRow.begin(), entriesInRow.end(), [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != column; });
+                if (newBackwardEntries.size() < numberOfSubstitutedEntries) {
+                    newBackwardEntries.resize(numberOfSubstitutedEntries);
+                }
+                for (uint_fast64_t offset = 0; offset < numberOfSubstitutedEntries; ++offset) {
+                    newBackwardEntries[offset].clear();
+                    newBackwardEntries[offset].reserve(elementsWithEntryInColumnEqualRow.size());
                 }
                 
                 // Now go through the rows with an entry in the column corresponding to the current row and substitute
@@ -103,70 +153,72 @@ namespace storm {
                     FlexibleRowType& predecessorForwardTransitions = matrix.getRow(predecessor);
                     FlexibleRowIterator multiplyElement = std::find_if(predecessorForwardTransitions.begin(), predecessorForwardTransitions.end(), [&](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() == column; });
                     
-                    // Make sure we have found the probability and set it to zero.
+                    // Make sure we have found the probability.
                     STORM_LOG_THROW(multiplyElement != predecessorForwardTransitions.end(), storm::exceptions::InvalidStateException, "No probability for successor found.");
                     ValueType multiplyFactor = multiplyElement->getValue();
-                    multiplyElement->setValue(storm::utility::zero<ValueType>());
-                    
-                    // At this point, we need to update the (forward) transitions of the predecessor.
-                    FlexibleRowIterator first1 = predecessorForwardTransitions.begin();
-                    FlexibleRowIterator last1 = predecessorForwardTransitions.end();
-                    FlexibleRowIterator first2 = entriesInRow.begin();
-                    FlexibleRowIterator last2 = entriesInRow.end();
                     
-                    FlexibleRowType newSuccessors;
-                    newSuccessors.reserve((last1 - first1) + (last2 - first2));
-                    std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
-                    
-                    uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
-                    // Now we merge the two successor lists. (Code taken from std::set_union and modified to suit our needs).
-                    for (; first1 != last1; ++result) {
-                        // Skip the transitions to the state that is currently being eliminated.
-                        if (first1->getColumn() == column || (first2 != last2 && first2->getColumn() == column)) {
-                            if (first1->getColumn() == column) {
-                                ++first1;
-                            }
-                            if (first2 != last2 && first2->getColumn() == column) {
-                                ++first2;
-                            }
-                            continue;
+                    // At this point, we need to update the (forward) transitions of the predecessor. We merge the two
+                    // (sorted) successor lists in place by growing the row of the predecessor and filling it from the
+                    // back. Since the merged row has at most as many entries as the grown row, we never overwrite an
+                    // entry that is yet to be considered. The transitions to the state that is currently being
+                    // eliminated are dropped.
+                    int_fast64_t first1 = static_cast<int_fast64_t>(predecessorForwardTransitions.size()) - 1;
+                    auto first2 = entriesInRow.rbegin();
+                    auto last2 = entriesInRow.rend();
+                    predecessorForwardTransitions.resize(predecessorForwardTransitions.size() + numberOfSubstitutedEntries);
+                    uint_fast64_t target = predecessorForwardTransitions.size();
+                    uint_fast64_t successorOffsetInNewBackwardTransitions = numberOfSubstitutedEntries;
+                    while (true) {
+                        while (first1 >= 0 && predecessorForwardTransitions[first1].getColumn() == column) {
+                            --first1;
+                        }
+                        while (first2 != last2 && first2->getColumn() == column) {
+                            ++first2;
                         }
-                        
                         if (first2 == last2) {
-                            std::copy_if(first1, last1, result, [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != column; } );
                             break;
                         }
-                        if (first2->getColumn() < first1->getColumn()) {
-                            auto successorEntry = storm::utility::simplify(std::move(*first2 * multiplyFactor));
-                            *result = successorEntry;
-                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorEntry.getValue());
+                        
+                        --target;
+                        if (first1 < 0 || predecessorForwardTransitions[first1].getColumn() < first2->getColumn()) {
+                            // The predecessor gets a new successor, i.e. the elimination causes fill-in.
+                            ++numberOfFillInEntries;
+                            --successorOffsetInNewBackwardTransitions;
+                            ValueType probability = multiply(first2->getValue(), multiplyFactor);
+                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
+                            predecessorForwardTransitions[target] = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first2->getColumn(), std::move(probability));
                             ++first2;
-                            ++successorOffsetInNewBackwardTransitions;
-                        } else if (first1->getColumn() < first2->getColumn()) {
-                            *result = *first1;
-                            ++first1;
+                        } else if (predecessorForwardTransitions[first1].getColumn() > first2->getColumn()) {
+                            if (static_cast<int_fast64_t>(target) != first1) {
+                                predecessorForwardTransitions[target] = std::move(predecessorForwardTransitions[first1]);
+                            }
+                            --first1;
                         } else {
-                            ValueType sprod = multiplyFactor * first2->getValue();
-                            ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
-                            auto probability = storm::utility::simplify(sum);
-                            *result = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first1->getColumn(), probability);
+                            --successorOffsetInNewBackwardTransitions;
+                            ValueType probability = add(predecessorForwardTransitions[first1].getValue(), multiply(multiplyFactor, first2->getValue()));
                             newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
-                            ++first1;
+                            predecessorForwardTransitions[target] = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first2->getColumn(), std::move(probability));
+                            --first1;
                             ++first2;
-                            ++successorOffsetInNewBackwardTransitions;
                         }
                     }
-                    for (; first2 != last2; ++first2) {
-                        if (first2->getColumn() != column) {
-                            auto stateProbability = storm::utility::simplify(std::move(*first2 * multiplyFactor));
-                            *result = stateProbability;
-                            newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, stateProbability.getValue());
-                            ++successorOffsetInNewBackwardTransitions;
+                    STORM_LOG_ASSERT(successorOffsetInNewBackwardTransitions == 0, "Not all successors were substituted.");
+                    
+                    // The remaining transitions of the predecessor are kept (except for the one to the eliminated state).
+                    for (; first1 >= 0; --first1) {
+                        if (predecessorForwardTransitions[first1].getColumn() != column) {
+                            --target;
+                            if (static_cast<int_fast64_t>(target) != first1) {
+                                predecessorForwardTransitions[target] = std::move(predecessorForwardTransitions[first1]);
+                            }
                         }
                     }
                     
-                    // Now move the new transitions in place.
-                    predecessorForwardTransitions = std::move(newSuccessors);
+                    // Finally, shift the merged row to the front.
+                    if (target > 0) {
+                        std::move(predecessorForwardTransitions.begin() + target, predecessorForwardTransitions.end(), predecessorForwardTransitions.begin());
+                        predecessorForwardTransitions.resize(predecessorForwardTransitions.size() - target);
+                    }
                     STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
                     
                     updatePredecessor(predecessor, multiplyFactor, row);
@@ -182,6 +234,11 @@ namespace storm {
                         continue;
                     }
                     
+                    // If the row of the successor may be modified concurrently, we need to hold the corresponding lock.
+                    std::unique_lock<std::mutex> successorLock;
+                    if (transposedRowMutexes) {
+                        successorLock = std::unique_lock<std::mutex>((*transposedRowMutexes)[successorEntry.getColumn() % transposedRowMutexes->size()]);
+                    }
                     FlexibleRowType& successorBackwardTransitions = transposedMatrix.getRow(successorEntry.getColumn());
                     
                     // Delete the current state as a predecessor of the successor state only if we are going to remove the
@@ -197,7 +254,10 @@ namespace storm {
                     FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
                     FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
                     
-                    FlexibleRowType newPredecessors;
+                    // The new predecessors are collected in a buffer that is swapped with the row afterwards. This way,
+                    // the memory of the rows is recycled rather than reallocated in every elimination.
+                    FlexibleRowType& newPredecessors = rowBuffer;
+                    newPredecessors.clear();
                     newPredecessors.reserve((last1 - first1) + (last2 - first2));
                     std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
                     
@@ -230,7 +290,7 @@ namespace storm {
                         std::copy_if(first2, last2, result, [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != row; });
                     }
                     // Now move the new predecessors in place.
-                    successorBackwardTransitions = std::move(newPredecessors);
+                    successorBackwardTransitions.swap(newPredecessors);
                     ++successorOffsetInNewBackwardTransitions;
                 }
                 STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
@@ -250,6 +310,31 @@ namespace storm {
                 }
             }
             
+            template<typename ValueType, ScalingMode Mode>
+            void EliminatorBase<ValueType, Mode>::setTransposedRowMutexes(std::vector<std::mutex>* mutexes) {
+                transposedRowMutexes = mutexes;
+            }
+            
+            template<typename ValueType, ScalingMode Mode>
+            uint64_t EliminatorBase<ValueType, Mode>::getNumberOfFillInEntries() const {
+                return numberOfFillInEntries;
+            }
+            
+            template<typename ValueType, ScalingMode Mode>
+            ValueType EliminatorBase<ValueType, Mode>::multiply(ValueType const& first, ValueType const& second) const {
+                return detail::multiply(first, second, useArithmeticCache);
+            }
+            
+            template<typename ValueType, ScalingMode Mode>
+            ValueType EliminatorBase<ValueType, Mode>::add(ValueType const& first, ValueType const& second) const {
+                return detail::add(first, second, useArithmeticCache);
+            }
+            
+            template<typename ValueType, ScalingMode Mode>
+            ValueType EliminatorBase<ValueType, Mode>::divideOneMinus(ValueType const& value) const {
+                return detail::divideOneMinus(value, useArithmeticCache);
+            }
+            
             template<typename ValueType, ScalingMode Mode>
             void EliminatorBase<ValueType, Mode>::updateValue(storm::storage::sparse::state_type const&, ValueType const&) {
                 // Intentionally left empty.
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <mutex>
+#include <vector>
+
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/storage/FlexibleSparseMatrix.h"
 
+#include "storm/solver/stateelimination/RationalFunctionArithmeticCache.h"
+
 namespace storm {
     namespace solver {
         namespace stateelimination {
@@ -23,6 +28,20 @@ namespace storm {
 
                 void eliminate(uint64_t row, uint64_t column, bool clearRow);
                 
+                /*!
+                 * Sets mutexes that guard the rows of the transposed matrix. If set, the row of the transposed matrix
+                 * that belongs to a successor of an eliminated row is only modified while holding the mutex with index
+                 * (successor modulo number of mutexes). This allows to eliminate rows with disjoint sets of
+                 * predecessors concurrently.
+                 */
+                void setTransposedRowMutexes(std::vector<std::mutex>* mutexes);
+                
+                /*!
+                 * Retrieves the number of entries that were added to the matrix by the eliminations performed so far
+                 * (i.e. the fill-in).
+                 */
+                uint64_t getNumberOfFillInEntries() const;
+                
                 // Provide virtual methods that can be customized by subclasses to govern side-effect of the elimination.
                 virtual void updateValue(storm::storage::sparse::state_type const& state, ValueType const& loopProbability);
                 virtual void updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability, storm::storage::sparse::state_type const& state);
@@ -31,8 +50,31 @@ namespace storm {
                 virtual bool isFilterPredecessor() const;
                 
             protected:
+                // Helpers for the arithmetic performed during elimination. The results are simplified and, if
+                // requested, looked up in the arithmetic cache (only for rational functions).
+                ValueType multiply(ValueType const& first, ValueType const& second) const;
+                ValueType add(ValueType const& first, ValueType const& second) const;
+                ValueType divideOneMinus(ValueType const& value) const;
+                
                 storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
                 storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+                
+            private:
+                // The number of entries added to the matrix by the eliminations.
+                uint64_t numberOfFillInEntries;
+                
+                // Whether the arithmetic cache is to be used.
+                bool useArithmeticCache;
+                
+                // Keeps the cached arithmetic results alive while the eliminator exists.
+                ArithmeticCacheScope<ValueType> arithmeticCacheScope;
+                
+                // If set, the mutexes guarding the rows of the transposed matrix.
+                std::vector<std::mutex>* transposedRowMutexes;
+                
+                // Buffers that are reused across eliminations to avoid allocating memory in every elimination.
+                std::vector<FlexibleRowType> newBackwardEntries;
+                FlexibleRowType rowBuffer;
             };
             
         } // namespace stateelimination
@@ -0,0 +1,240 @@
+#include "storm/solver/stateelimination/FillReducingOrdering.h"
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <set>
+#include <unordered_map>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace stateelimination {
+
+            template<typename ValueType>
+            FillReducingOrdering::FillReducingOrdering(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& states) : states(states.begin(), states.end()), graph(this->states.size()) {
+                STORM_LOG_ASSERT(transitionMatrix.hasTrivialRowGrouping(), "Expected a matrix with trivial row grouping.");
+                std::vector<uint_fast64_t> vertexOfState = states.getNumberOfSetBitsBeforeIndices();
+                for (uint64_t vertex = 0; vertex < this->states.size(); ++vertex) {
+                    for (auto const& entry : transitionMatrix.getRow(this->states[vertex])) {
+                        if (entry.getColumn() != this->states[vertex] && states.get(entry.getColumn())) {
+                            uint64_t neighbor = vertexOfState[entry.getColumn()];
+                            graph[vertex].push_back(neighbor);
+                            graph[neighbor].push_back(vertex);
+                        }
+                    }
+                }
+                for (auto& neighbors : graph) {
+                    std::sort(neighbors.begin(), neighbors.end());
+                    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+                }
+            }
+
+            uint64_t FillReducingOrdering::eliminateVertex(GraphType& graph, uint64_t vertex, std::vector<uint64_t>& buffer) {
+                std::vector<uint64_t> neighbors = std::move(graph[vertex]);
+                graph[vertex].clear();
+
+                uint64_t fillIn = 0;
+                for (auto const& neighbor : neighbors) {
+                    // Connect the neighbor to all other neighbors of the eliminated vertex.
+                    std::vector<uint64_t>& adjacent = graph[neighbor];
+                    buffer.clear();
+                    std::set_union(adjacent.begin(), adjacent.end(), neighbors.begin(), neighbors.end(), std::back_inserter(buffer));
+                    buffer.erase(std::remove_if(buffer.begin(), buffer.end(), [&] (uint64_t const& other) { return other == vertex || other == neighbor; }), buffer.end());
+
+                    // The old neighbors included the eliminated vertex.
+                    fillIn += buffer.size() + 1 - adjacent.size();
+                    adjacent.swap(buffer);
+                }
+
+                // Every new edge was counted at both of its endpoints.
+                return fillIn / 2;
+            }
+
+            std::vector<uint64_t> FillReducingOrdering::computeMinimumDegreeOrder(GraphType graph) {
+                std::set<std::pair<uint64_t, uint64_t>> queue;
+                for (uint64_t vertex = 0; vertex < graph.size(); ++vertex) {
+                    queue.emplace(graph[vertex].size(), vertex);
+                }
+
+                std::vector<uint64_t> order;
+                order.reserve(graph.size());
+                std::vector<uint64_t> buffer;
+                while (!queue.empty()) {
+                    uint64_t vertex = queue.begin()->second;
+                    queue.erase(queue.begin());
+                    order.push_back(vertex);
+
+                    // The degrees of the neighbors change, so we need to update their position in the queue.
+                    std::vector<uint64_t> neighbors = graph[vertex];
+                    for (auto const& neighbor : neighbors) {
+                        queue.erase(std::make_pair(graph[neighbor].size(), neighbor));
+                    }
+                    eliminateVertex(graph, vertex, buffer);
+                    for (auto const& neighbor : neighbors) {
+                        queue.emplace(graph[neighbor].size(), neighbor);
+                    }
+                }
+                return order;
+            }
+
+            std::vector<storm::storage::sparse::state_type> FillReducingOrdering::computeMinimumDegreeOrder() const {
+                std::vector<storm::storage::sparse::state_type> result;
+                result.reserve(states.size());
+                for (auto const& vertex : computeMinimumDegreeOrder(graph)) {
+                    result.push_back(states[vertex]);
+                }
+                return result;
+            }
+
+            std::vector<storm::storage::sparse::state_type> FillReducingOrdering::computeNestedDissectionOrder(uint64_t maximalPartSize) const {
+                std::vector<uint64_t> vertices(graph.size());
+                std::iota(vertices.begin(), vertices.end(), 0);
+                std::vector<uint64_t> marks(graph.size(), 0);
+                uint64_t currentMark = 0;
+                std::vector<uint64_t> order;
+                order.reserve(graph.size());
+                performNestedDissection(vertices, std::max<uint64_t>(maximalPartSize, 1), marks, currentMark, order);
+                STORM_LOG_ASSERT(order.size() == graph.size(), "Not all states were ordered.");
+
+                std::vector<storm::storage::sparse::state_type> result;
+                result.reserve(states.size());
+                for (auto const& vertex : order) {
+                    result.push_back(states[vertex]);
+                }
+                return result;
+            }
+
+            void FillReducingOrdering::performNestedDissection(std::vector<uint64_t> const& vertices, uint64_t maximalPartSize, std::vector<uint64_t>& marks, uint64_t& currentMark, std::vector<uint64_t>& order) const {
+                if (vertices.empty()) {
+                    return;
+                }
+
+                // Small parts are ordered by minimum degree on the subgraph induced by the part.
+                auto orderByMinimumDegree = [&] () {
+                    std::unordered_map<uint64_t, uint64_t> localIndices;
+                    for (uint64_t index = 0; index < vertices.size(); ++index) {
+                        localIndices.emplace(vertices[index], index);
+                    }
+                    GraphType subgraph(vertices.size());
+                    for (uint64_t index = 0; index < vertices.size(); ++index) {
+                        for (auto const& neighbor : graph[vertices[index]]) {
+                            auto localIt = localIndices.find(neighbor);
+                            if (localIt != localIndices.end()) {
+                                subgraph[index].push_back(localIt->second);
+                            }
+                        }
+                        std::sort(subgraph[index].begin(), subgraph[index].end());
+                    }
+                    for (auto const& localVertex : computeMinimumDegreeOrder(std::move(subgraph))) {
+                        order.push_back(vertices[localVertex]);
+                    }
+                };
+                if (vertices.size() <= maximalPartSize) {
+                    orderByMinimumDegree();
+                    return;
+                }
+
+                // Mark the vertices of the part. As marks only increase, a vertex belongs to the part iff its mark is
+                // at least the mark of the part.
+                uint64_t partMark = ++currentMark;
+                for (auto const& vertex : vertices) {
+                    marks[vertex] = partMark;
+                }
+
+                // Performs a breadth-first search within the part and returns the reached vertices and their levels.
+                auto breadthFirstSearch = [&] (uint64_t start) {
+                    uint64_t visitedMark = ++currentMark;
+                    std::vector<std::pair<uint64_t, uint64_t>> reached;
+                    reached.emplace_back(start, 0);
+                    marks[start] = visitedMark;
+                    for (uint64_t index = 0; index < reached.size(); ++index) {
+                        for (auto const& neighbor : graph[reached[index].first]) {
+                            if (marks[neighbor] >= partMark && marks[neighbor] < visitedMark) {
+                                marks[neighbor] = visitedMark;
+                                reached.emplace_back(neighbor, reached[index].second + 1);
+                            }
+                        }
+                    }
+                    return reached;
+                };
+
+                std::vector<std::pair<uint64_t, uint64_t>> reached = breadthFirstSearch(vertices.front());
+                if (reached.size() < vertices.size()) {
+                    // The part is not connected, so we treat its components separately.
+                    std::vector<std::vector<uint64_t>> components;
+                    components.emplace_back();
+                    for (auto const& vertexLevelPair : reached) {
+                        components.back().push_back(vertexLevelPair.first);
+                    }
+                    for (auto const& vertex : vertices) {
+                        if (marks[vertex] == partMark) {
+                            components.emplace_back();
+                            for (auto const& vertexLevelPair : breadthFirstSearch(vertex)) {
+                                components.back().push_back(vertexLevelPair.first);
+                            }
+                        }
+                    }
+                    for (auto const& component : components) {
+                        performNestedDissection(component, maximalPartSize, marks, currentMark, order);
+                    }
+                    return;
+                }
+
+                // Start the level structure from a pseudo-peripheral vertex (the vertex farthest from the first one)
+                // to obtain many (and thus small) levels.
+                reached = breadthFirstSearch(reached.back().first);
+                uint64_t maximalLevel = reached.back().second;
+                if (maximalLevel < 2) {
+                    // The part is too dense to be separated by a level.
+                    orderByMinimumDegree();
+                    return;
+                }
+
+                // The middle level separates the lower and the upper levels.
+                uint64_t separatorLevel = maximalLevel / 2;
+                std::vector<uint64_t> lowerPart;
+                std::vector<uint64_t> upperPart;
+                std::vector<uint64_t> separator;
+                for (auto const& vertexLevelPair : reached) {
+                    if (vertexLevelPair.second < separatorLevel) {
+                        lowerPart.push_back(vertexLevelPair.first);
+                    } else if (vertexLevelPair.second == separatorLevel) {
+                        separator.push_back(vertexLevelPair.first);
+                    } else {
+                        upperPart.push_back(vertexLevelPair.first);
+                    }
+                }
+
+                performNestedDissection(lowerPart, maximalPartSize, marks, currentMark, order);
+                performNestedDissection(upperPart, maximalPartSize, marks, currentMark, order);
+                order.insert(order.end(), separator.begin(), separator.end());
+            }
+
+            uint64_t FillReducingOrdering::computeFillIn(std::vector<storm::storage::sparse::state_type> const& order) const {
+                GraphType remainingGraph = graph;
+                std::vector<uint64_t> buffer;
+                uint64_t fillIn = 0;
+                for (auto const& state : order) {
+                    auto stateIt = std::lower_bound(states.begin(), states.end(), state);
+                    STORM_LOG_ASSERT(stateIt != states.end() && *stateIt == state, "The state " << state << " is not considered by the ordering.");
+                    fillIn += eliminateVertex(remainingGraph, std::distance(states.begin(), stateIt), buffer);
+                }
+                return fillIn;
+            }
+
+            template FillReducingOrdering::FillReducingOrdering(storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::BitVector const& states);
+
+#ifdef STORM_HAVE_CARL
+            template FillReducingOrdering::FillReducingOrdering(storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::BitVector const& states);
+            template FillReducingOrdering::FillReducingOrdering(storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::BitVector const& states);
+#endif
+        }
+    }
+}
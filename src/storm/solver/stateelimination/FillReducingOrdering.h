@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/sparse/StateType.h"
+
+namespace storm {
+    namespace storage {
+        class BitVector;
+
+        template<typename ValueType>
+        class FlexibleSparseMatrix;
+    }
+
+    namespace solver {
+        namespace stateelimination {
+
+            /*!
+             * Computes elimination orders that aim at keeping the fill-in (the transitions introduced by eliminating
+             * states) small. The orders are computed on the undirected graph underlying the transitions between the
+             * given states using techniques from sparse direct solvers, namely minimum degree and nested dissection
+             * orders. As eliminating a state makes all its predecessors point to all its successors, the fill-in on
+             * the undirected graph over-approximates the fill-in of the actual (directed) elimination.
+             */
+            class FillReducingOrdering {
+            public:
+                /*!
+                 * Creates the undirected graph underlying the transitions between the given states.
+                 *
+                 * @param transitionMatrix The transitions. Needs to have a trivial row grouping.
+                 * @param states The states that are to be ordered.
+                 */
+                template<typename ValueType>
+                FillReducingOrdering(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& states);
+
+                /*!
+                 * Computes an order in which repeatedly a state of minimal degree (in the graph resulting from
+                 * eliminating the previous states) is chosen.
+                 */
+                std::vector<storm::storage::sparse::state_type> computeMinimumDegreeOrder() const;
+
+                /*!
+                 * Computes a nested dissection order, i.e. the graph is recursively split by small separators that are
+                 * eliminated after the parts they separate. Parts with at most the given number of states are ordered
+                 * by minimum degree.
+                 */
+                std::vector<storm::storage::sparse::state_type> computeNestedDissectionOrder(uint64_t maximalPartSize = 64) const;
+
+                /*!
+                 * Computes the number of edges that eliminating the states in the given order adds to the undirected
+                 * graph.
+                 */
+                uint64_t computeFillIn(std::vector<storm::storage::sparse::state_type> const& order) const;
+
+            private:
+                typedef std::vector<std::vector<uint64_t>> GraphType;
+
+                /*!
+                 * Eliminates the given vertex from the graph, i.e. connects all its neighbors and removes it.
+                 *
+                 * @return The number of added edges.
+                 */
+                static uint64_t eliminateVertex(GraphType& graph, uint64_t vertex, std::vector<uint64_t>& buffer);
+
+                /*!
+                 * Computes a minimum degree order of the given graph.
+                 */
+                static std::vector<uint64_t> computeMinimumDegreeOrder(GraphType graph);
+
+                /*!
+                 * Orders the given vertices by nested dissection and appends them to the given order.
+                 */
+                void performNestedDissection(std::vector<uint64_t> const& vertices, uint64_t maximalPartSize, std::vector<uint64_t>& marks, uint64_t& currentMark, std::vector<uint64_t>& order) const;
+
+                // The states that are ordered. Vertex i of the graph corresponds to the i-th state.
+                std::vector<storm::storage::sparse::state_type> states;
+
+                // The (sorted) neighbors of each vertex.
+                GraphType graph;
+            };
+
+        }
+    }
+}
@@ -0,0 +1,146 @@
+#include "storm/solver/stateelimination/RationalFunctionArithmeticCache.h"
+
+#include <sstream>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/EliminationSettings.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace stateelimination {
+
+#ifdef STORM_HAVE_CARL
+            const uint64_t RationalFunctionArithmeticCache::maximalNumberOfEntries = 1000000;
+
+            RationalFunctionArithmeticCache& RationalFunctionArithmeticCache::getInstance() {
+                static RationalFunctionArithmeticCache instance;
+                return instance;
+            }
+
+            template<typename OperationType>
+            storm::RationalFunction RationalFunctionArithmeticCache::lookupOrCompute(Operation const& operation, KeyType&& key, OperationType const& compute) {
+                uint64_t index = static_cast<uint64_t>(operation);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++lookups[index];
+                    auto findRes = caches[index].find(key);
+                    if (findRes != caches[index].end()) {
+                        ++hits[index];
+                        return findRes->second;
+                    }
+                }
+
+                // Perform the (expensive) computation without holding the lock.
+                storm::RationalFunction result = compute(key.first, key.second);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if (caches[index].size() >= maximalNumberOfEntries) {
+                    STORM_LOG_TRACE("Dropping the cached rational function arithmetic results as the cache is full.");
+                    caches[index].clear();
+                }
+                caches[index].emplace(std::move(key), result);
+                return result;
+            }
+
+            storm::RationalFunction RationalFunctionArithmeticCache::multiply(storm::RationalFunction const& first, storm::RationalFunction const& second) {
+                // Multiplication is commutative, so we normalize the order of the operands.
+                boost::hash<storm::RationalFunction> hasher;
+                KeyType key = hasher(first) <= hasher(second) ? KeyType(first, second) : KeyType(second, first);
+                return lookupOrCompute(Operation::Multiply, std::move(key), [] (storm::RationalFunction const& left, storm::RationalFunction const& right) { return storm::utility::simplify((storm::RationalFunction) (left * right)); });
+            }
+
+            storm::RationalFunction RationalFunctionArithmeticCache::add(storm::RationalFunction const& first, storm::RationalFunction const& second) {
+                // Addition is commutative, so we normalize the order of the operands.
+                boost::hash<storm::RationalFunction> hasher;
+                KeyType key = hasher(first) <= hasher(second) ? KeyType(first, second) : KeyType(second, first);
+                return lookupOrCompute(Operation::Add, std::move(key), [] (storm::RationalFunction const& left, storm::RationalFunction const& right) { return storm::utility::simplify((storm::RationalFunction) (left + right)); });
+            }
+
+            storm::RationalFunction RationalFunctionArithmeticCache::divideOneMinus(storm::RationalFunction const& value) {
+                return lookupOrCompute(Operation::DivideOneMinus, KeyType(value, storm::utility::one<storm::RationalFunction>()), [] (storm::RationalFunction const& argument, storm::RationalFunction const& one) { return storm::utility::simplify((storm::RationalFunction) (one / (one - argument))); });
+            }
+
+            void RationalFunctionArithmeticCache::clear() {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (auto& cache : caches) {
+                    cache.clear();
+                }
+            }
+
+            void RationalFunctionArithmeticCache::resetStatistics() {
+                std::lock_guard<std::mutex> lock(mutex);
+                lookups.fill(0);
+                hits.fill(0);
+            }
+
+            uint64_t RationalFunctionArithmeticCache::getNumberOfLookups(Operation const& operation) const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return lookups[static_cast<uint64_t>(operation)];
+            }
+
+            uint64_t RationalFunctionArithmeticCache::getNumberOfHits(Operation const& operation) const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return hits[static_cast<uint64_t>(operation)];
+            }
+
+            void RationalFunctionArithmeticCache::printStatistics(std::ostream& out) const {
+                std::lock_guard<std::mutex> lock(mutex);
+                printStatisticsUnlocked(out);
+            }
+
+            void RationalFunctionArithmeticCache::printStatisticsUnlocked(std::ostream& out) const {
+                std::array<std::string, 3> names = {{"multiplications", "additions", "1/(1-x) scalings"}};
+                out << "Rational function arithmetic cache (hits/lookups):" << std::endl;
+                for (uint64_t index = 0; index < names.size(); ++index) {
+                    out << "    * " << names[index] << ": " << hits[index] << "/" << lookups[index];
+                    if (lookups[index] > 0) {
+                        out << " (" << (100.0 * hits[index] / lookups[index]) << "%)";
+                    }
+                    out << std::endl;
+                }
+            }
+
+            void RationalFunctionArithmeticCache::acquire() {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++numberOfUsers;
+            }
+
+            void RationalFunctionArithmeticCache::release() {
+                std::lock_guard<std::mutex> lock(mutex);
+                STORM_LOG_ASSERT(numberOfUsers > 0, "Releasing the arithmetic cache without any users.");
+                if (--numberOfUsers > 0) {
+                    return;
+                }
+                if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                    std::stringstream statisticsStream;
+                    printStatisticsUnlocked(statisticsStream);
+                    STORM_PRINT_AND_LOG(std::endl << statisticsStream.str());
+                }
+                // The cached results are not needed beyond the current elimination(s).
+                for (auto& cache : caches) {
+                    cache.clear();
+                }
+                lookups.fill(0);
+                hits.fill(0);
+            }
+
+            ArithmeticCacheScope<storm::RationalFunction>::ArithmeticCacheScope() : active(storm::settings::hasModule<storm::settings::modules::EliminationSettings>() && storm::settings::getModule<storm::settings::modules::EliminationSettings>().isUseArithmeticCacheSet()) {
+                if (active) {
+                    RationalFunctionArithmeticCache::getInstance().acquire();
+                }
+            }
+
+            ArithmeticCacheScope<storm::RationalFunction>::~ArithmeticCacheScope() {
+                if (active) {
+                    RationalFunctionArithmeticCache::getInstance().release();
+                }
+            }
+#endif
+
+        }
+    }
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
+
+#include "storm-config.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+    namespace solver {
+        namespace stateelimination {
+
+            /*!
+             * Keeps the arithmetic cache alive while it exists. Every eliminator holds such a scope, and callers that
+             * perform several eliminations (e.g. a query) may open an enclosing scope to share the cached results among
+             * them. Once the last scope is closed, the statistics of the cache are reported (if requested) and the cached
+             * results are dropped, so the cache does not grow across queries.
+             *
+             * Only rational function arithmetic is cached, so for other value types, scopes have no effect.
+             */
+            template<typename ValueType>
+            class ArithmeticCacheScope {
+            public:
+                ArithmeticCacheScope() = default;
+            };
+
+#ifdef STORM_HAVE_CARL
+            /*!
+             * Memoizes the (simplified) results of the rational function arithmetic performed during state elimination.
+             * Since the polynomials of the rational functions are hash-consed (by carl's factorization cache), the
+             * operands can be hashed and compared cheaply. This pays off for models in which the same transition
+             * probabilities (e.g. p and 1-p) occur over and over again, as then the same products and sums (and the
+             * gcd computations needed to simplify them) are requested many times across elimination steps.
+             *
+             * The cache may be used by several threads concurrently.
+             */
+            class RationalFunctionArithmeticCache {
+            public:
+                enum class Operation { Multiply = 0, Add = 1, DivideOneMinus = 2 };
+
+                /*!
+                 * Retrieves the (process-wide) cache.
+                 */
+                static RationalFunctionArithmeticCache& getInstance();
+
+                /*!
+                 * Computes the simplified product of the given functions.
+                 */
+                storm::RationalFunction multiply(storm::RationalFunction const& first, storm::RationalFunction const& second);
+
+                /*!
+                 * Computes the simplified sum of the given functions.
+                 */
+                storm::RationalFunction add(storm::RationalFunction const& first, storm::RationalFunction const& second);
+
+                /*!
+                 * Computes the simplified value of 1 / (1 - value).
+                 */
+                storm::RationalFunction divideOneMinus(storm::RationalFunction const& value);
+
+                /*!
+                 * Removes all cached results. The statistics are kept.
+                 */
+                void clear();
+
+                /*!
+                 * Resets the statistics.
+                 */
+                void resetStatistics();
+
+                /*!
+                 * Retrieves the number of lookups and the number of lookups that could be answered from the cache for
+                 * the given operation.
+                 */
+                uint64_t getNumberOfLookups(Operation const& operation) const;
+                uint64_t getNumberOfHits(Operation const& operation) const;
+
+                void printStatistics(std::ostream& out) const;
+
+            private:
+                friend class ArithmeticCacheScope<storm::RationalFunction>;
+
+                RationalFunctionArithmeticCache() = default;
+
+                /*!
+                 * Registers and unregisters a user of the cache (see ArithmeticCacheScope). Once the last user is
+                 * unregistered, the statistics are reported (if requested) and the cache is cleared.
+                 */
+                void acquire();
+                void release();
+
+                void printStatisticsUnlocked(std::ostream& out) const;
+
+                typedef std::pair<storm::RationalFunction, storm::RationalFunction> KeyType;
+                typedef std::unordered_map<KeyType, storm::RationalFunction, boost::hash<KeyType>> CacheType;
+
+                template<typename OperationType>
+                storm::RationalFunction lookupOrCompute(Operation const& operation, KeyType&& key, OperationType const& compute);
+
+                // The number of entries per operation after which the cached results of the operation are dropped.
+                static const uint64_t maximalNumberOfEntries;
+
+                mutable std::mutex mutex;
+                std::array<CacheType, 3> caches;
+                std::array<uint64_t, 3> lookups = {{0, 0, 0}};
+                std::array<uint64_t, 3> hits = {{0, 0, 0}};
+                uint64_t numberOfUsers = 0;
+            };
+
+            template<>
+            class ArithmeticCacheScope<storm::RationalFunction> {
+            public:
+                /*!
+                 * Opens a scope of the arithmetic cache if the cache is enabled.
+                 */
+                ArithmeticCacheScope();
+                ~ArithmeticCacheScope();
+
+                ArithmeticCacheScope(ArithmeticCacheScope const&) = delete;
+                ArithmeticCacheScope& operator=(ArithmeticCacheScope const&) = delete;
+
+            private:
+                // Whether the cache is enabled (and hence a scope was opened).
+                bool active;
+            };
+#endif
+
+        }
+    }
+}
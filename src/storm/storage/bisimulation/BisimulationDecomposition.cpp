@@ -184,6 +184,7 @@ namespace storm {
             std::chrono::high_resolution_clock::time_point initialPartitionStart = std::chrono::high_resolution_clock::now();
             // initialize the initial partition.
             if (options.measureDrivenInitialPartition) {
+                STORM_LOG_THROW(!options.initialPartition, storm::exceptions::InvalidOptionException, "Unable to combine the measure-driven initial partition with a given initial partition.");
                 STORM_LOG_THROW(options.phiStates, storm::exceptions::InvalidOptionException, "Unable to compute measure-driven initial partition without phi states.");
                 STORM_LOG_THROW(options.psiStates, storm::exceptions::InvalidOptionException, "Unable to compute measure-driven initial partition without psi states.");
                 this->initializeMeasureDrivenPartition();
@@ -285,6 +286,13 @@ namespace storm {
                 partition.splitStates(model.getStates(label));
             }
             
+            // If a mapping of states to blocks was given, we split the partition accordingly.
+            if (options.initialPartition) {
+                std::vector<uint_fast64_t> const& stateToBlock = options.initialPartition.get();
+                STORM_LOG_THROW(stateToBlock.size() == model.getNumberOfStates(), storm::exceptions::InvalidOptionException, "The given initial partition does not match the number of states of the model.");
+                partition.split([&stateToBlock] (storm::storage::sparse::state_type const& a, storm::storage::sparse::state_type const& b) { return stateToBlock[a] < stateToBlock[b]; });
+            }
+            
             // If the model has state rewards, we need to consider them, because otherwise reward properties are not
             // preserved.
             if (options.getKeepRewards() && model.hasRewardModel()) {
@@ -315,6 +323,17 @@ namespace storm {
             // Intentionally left empty.
         }
         
+        template<typename ModelType, typename BlockDataType>
+        std::vector<uint_fast64_t> BisimulationDecomposition<ModelType, BlockDataType>::getStateToBlockMapping() const {
+            std::vector<uint_fast64_t> stateToBlock(model.getNumberOfStates());
+            for (uint_fast64_t blockIndex = 0; blockIndex < this->size(); ++blockIndex) {
+                for (auto state : this->getBlock(blockIndex)) {
+                    stateToBlock[state] = blockIndex;
+                }
+            }
+            return stateToBlock;
+        }
+        
         template<typename ModelType, typename BlockDataType>
         void BisimulationDecomposition<ModelType, BlockDataType>::extractDecompositionBlocks() {
             // Now move the states from the internal partition into their final place in the decomposition. We do so in
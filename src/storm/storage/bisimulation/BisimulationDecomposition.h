@@ -109,6 +109,10 @@ namespace storm {
                     return this->keepRewards;
                 }
                 
+                void setKeepRewards(bool value) {
+                    this->keepRewards = value;
+                }
+                
                 bool isOptimizationDirectionSet() const {
                     return static_cast<bool>(optimalityType);
                 }
@@ -132,6 +136,11 @@ namespace storm {
                 /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
                 bool buildQuotient;
                 
+                /// An optional mapping from states to blocks (for example a previously computed bisimulation wrt. the
+                /// same atomic propositions) by which the label-based initial partition is split further. If it is
+                /// coarser than the bisimulation to compute, refinement starts closer to the fixed point.
+                boost::optional<std::vector<uint_fast64_t>> initialPartition;
+                
             private:
                 boost::optional<OptimizationDirection> optimalityType;
                 
@@ -196,6 +205,14 @@ namespace storm {
              */
             void computeBisimulationDecomposition();
             
+            /*!
+             * Retrieves the computed decomposition as a mapping from states to the indices of their blocks. This can
+             * be used as the initial partition of later decompositions of the same model.
+             *
+             * @return The mapping from states to blocks.
+             */
+            std::vector<uint_fast64_t> getStateToBlockMapping() const;
+            
         protected:
             /*!
              * Decomposes the given model into equivalance classes of a bisimulation.
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <memory>
+#include <set>
+#include <string>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/bisimulation/BisimulationType.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * Caches the (label-only) bisimulation partition of a model, i.e. the coarsest bisimulation that respects a
+         * given set of atomic propositions but no reward models. Later bisimulation queries for the same model and the
+         * same atomic propositions can start the refinement from the cached partition (and only need to refine it wrt.
+         * their reward models) instead of starting from the initial partition.
+         *
+         * The model is only referenced weakly, so the cache does not keep it alive and becomes inapplicable once the
+         * model is destroyed.
+         */
+        template<typename ModelType, typename PartitionType>
+        class BisimulationPartitionCache {
+        public:
+            BisimulationPartitionCache() : type(BisimulationType::Strong), hits(0), misses(0) {
+                // Intentionally left empty.
+            }
+
+            /*!
+             * Retrieves whether the cache holds a partition for the given model, bisimulation type and atomic
+             * propositions. Also counts the lookup as a cache hit or miss.
+             */
+            bool lookup(std::shared_ptr<ModelType> const& model, BisimulationType const& type, std::set<std::string> const& atomicPropositions) {
+                bool result = partition && this->model.lock() == model && this->type == type && this->atomicPropositions == atomicPropositions;
+                if (result) {
+                    ++hits;
+                } else {
+                    ++misses;
+                }
+                return result;
+            }
+
+            /*!
+             * Retrieves the cached partition. May only be called if a partition is cached.
+             */
+            PartitionType const& getPartition() const {
+                STORM_LOG_ASSERT(partition, "No partition cached.");
+                return partition.get();
+            }
+
+            /*!
+             * Caches the given partition for the given model, bisimulation type and atomic propositions. This replaces
+             * a previously cached partition.
+             */
+            void setPartition(std::shared_ptr<ModelType> const& model, BisimulationType const& type, std::set<std::string> const& atomicPropositions, PartitionType const& partition) {
+                this->model = model;
+                this->type = type;
+                this->atomicPropositions = atomicPropositions;
+                this->partition = partition;
+            }
+
+            /*!
+             * Removes the cached partition.
+             */
+            void clear() {
+                model.reset();
+                atomicPropositions.clear();
+                partition = boost::none;
+            }
+
+            uint64_t getNumberOfHits() const {
+                return hits;
+            }
+
+            uint64_t getNumberOfMisses() const {
+                return misses;
+            }
+
+        private:
+            // The model for which the partition was computed.
+            std::weak_ptr<ModelType> model;
+
+            // The bisimulation type of the cached partition.
+            BisimulationType type;
+
+            // The atomic propositions respected by the cached partition.
+            std::set<std::string> atomicPropositions;
+
+            // The cached partition (if any).
+            boost::optional<PartitionType> partition;
+
+            // The number of successful and unsuccessful lookups.
+            uint64_t hits;
+            uint64_t misses;
+        };
+
+    }
+}
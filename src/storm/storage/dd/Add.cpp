@@ -172,14 +172,16 @@ namespace storm {
 
         template<DdType LibraryType, typename ValueType>
         Add<LibraryType, ValueType> Add<LibraryType, ValueType>::sumAbstract(std::set<storm::expressions::Variable> const& metaVariables) const {
+            DdOperationWatch watch(this->getDdManager().getStatistics(), DdOperation::SumAbstract);
             Bdd<LibraryType> cube = Bdd<LibraryType>::getCube(this->getDdManager(), metaVariables);
-            return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.sumAbstract(cube.getInternalBdd()), Dd<LibraryType>::subtractMetaVariables(*this, cube));
+            return watch.finish(Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.sumAbstract(cube.getInternalBdd()), Dd<LibraryType>::subtractMetaVariables(*this, cube)));
         }
 
         template<DdType LibraryType, typename ValueType>
         Add<LibraryType, ValueType> Add<LibraryType, ValueType>::minAbstract(std::set<storm::expressions::Variable> const& metaVariables) const {
+            DdOperationWatch watch(this->getDdManager().getStatistics(), DdOperation::MinAbstract);
             Bdd<LibraryType> cube = Bdd<LibraryType>::getCube(this->getDdManager(), metaVariables);
-            return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.minAbstract(cube.getInternalBdd()), Dd<LibraryType>::subtractMetaVariables(*this, cube));
+            return watch.finish(Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.minAbstract(cube.getInternalBdd()), Dd<LibraryType>::subtractMetaVariables(*this, cube)));
         }
 		
 		template<DdType LibraryType, typename ValueType>
@@ -190,8 +192,9 @@ namespace storm {
         
         template<DdType LibraryType, typename ValueType>
         Add<LibraryType, ValueType> Add<LibraryType, ValueType>::maxAbstract(std::set<storm::expressions::Variable> const& metaVariables) const {
+            DdOperationWatch watch(this->getDdManager().getStatistics(), DdOperation::MaxAbstract);
             Bdd<LibraryType> cube = Bdd<LibraryType>::getCube(this->getDdManager(), metaVariables);
-            return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.maxAbstract(cube.getInternalBdd()), Dd<LibraryType>::subtractMetaVariables(*this, cube));
+            return watch.finish(Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.maxAbstract(cube.getInternalBdd()), Dd<LibraryType>::subtractMetaVariables(*this, cube)));
         }
 		
 		template<DdType LibraryType, typename ValueType>
@@ -274,6 +277,7 @@ namespace storm {
         
         template<DdType LibraryType, typename ValueType>
         Add<LibraryType, ValueType> Add<LibraryType, ValueType>::swapVariables(std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& metaVariablePairs) const {
+            DdOperationWatch watch(this->getDdManager().getStatistics(), DdOperation::SwapVariables);
             std::set<storm::expressions::Variable> newContainedMetaVariables;
             std::set<storm::expressions::Variable> deletedMetaVariables;
             std::vector<InternalBdd<LibraryType>> from;
@@ -311,7 +315,7 @@ namespace storm {
             std::set<storm::expressions::Variable> containedMetaVariables;
             std::set_union(tmp.begin(), tmp.end(), newContainedMetaVariables.begin(), newContainedMetaVariables.end(), std::inserter(containedMetaVariables, containedMetaVariables.begin()));
             STORM_LOG_THROW(from.size() == to.size(), storm::exceptions::InvalidArgumentException, "Unable to swap mismatching meta variables.");
-            return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.swapVariables(from, to), containedMetaVariables);
+            return watch.finish(Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.swapVariables(from, to), containedMetaVariables));
         }
         
         template<DdType LibraryType, typename ValueType>
@@ -348,6 +352,7 @@ namespace storm {
         
         template<DdType LibraryType, typename ValueType>
         Add<LibraryType, ValueType> Add<LibraryType, ValueType>::multiplyMatrix(Add<LibraryType, ValueType> const& otherMatrix, std::set<storm::expressions::Variable> const& summationMetaVariables) const {
+            DdOperationWatch watch(this->getDdManager().getStatistics(), DdOperation::MultiplyMatrix);
             // Create the summation variables.
             std::vector<InternalBdd<LibraryType>> summationDdVariables;
             for (auto const& metaVariable : summationMetaVariables) {
@@ -360,11 +365,12 @@ namespace storm {
             std::set<storm::expressions::Variable> containedMetaVariables;
             std::set_difference(unionOfMetaVariables.begin(), unionOfMetaVariables.end(), summationMetaVariables.begin(), summationMetaVariables.end(), std::inserter(containedMetaVariables, containedMetaVariables.begin()));
             
-            return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.multiplyMatrix(otherMatrix, summationDdVariables), containedMetaVariables);
+            return watch.finish(Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.multiplyMatrix(otherMatrix, summationDdVariables), containedMetaVariables));
         }
         
         template<DdType LibraryType, typename ValueType>
         Add<LibraryType, ValueType> Add<LibraryType, ValueType>::multiplyMatrix(Bdd<LibraryType> const& otherMatrix, std::set<storm::expressions::Variable> const& summationMetaVariables) const {
+            DdOperationWatch watch(this->getDdManager().getStatistics(), DdOperation::MultiplyMatrix);
             // Create the summation variables.
             std::vector<InternalBdd<LibraryType>> summationDdVariables;
             for (auto const& metaVariable : summationMetaVariables) {
@@ -377,7 +383,7 @@ namespace storm {
             std::set<storm::expressions::Variable> containedMetaVariables;
             std::set_difference(unionOfMetaVariables.begin(), unionOfMetaVariables.end(), summationMetaVariables.begin(), summationMetaVariables.end(), std::inserter(containedMetaVariables, containedMetaVariables.begin()));
             
-            return Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.multiplyMatrix(otherMatrix.getInternalBdd(), summationDdVariables), containedMetaVariables);
+            return watch.finish(Add<LibraryType, ValueType>(this->getDdManager(), internalAdd.multiplyMatrix(otherMatrix.getInternalBdd(), summationDdVariables), containedMetaVariables));
         }
 
         template<DdType LibraryType, typename ValueType>
@@ -685,6 +691,18 @@ namespace storm {
             return storm::storage::SparseMatrix<ValueType>(columnOdd.getTotalOffset(), std::move(rowIndications), std::move(columnsAndValues), boost::none);
         }
         
+        template<DdType LibraryType, typename ValueType>
+        void Add<LibraryType, ValueType>::multiplyWithExplicitVector(std::vector<ValueType> const& x, std::vector<ValueType>& result, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
+            multiplyWithExplicitVector(x, result, this->getDdManager().getSortedVariableIndices(rowMetaVariables), this->getDdManager().getSortedVariableIndices(columnMetaVariables), rowOdd, columnOdd);
+        }
+        
+        template<DdType LibraryType, typename ValueType>
+        void Add<LibraryType, ValueType>::multiplyWithExplicitVector(std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
+            STORM_LOG_ASSERT(x.size() == columnOdd.getTotalOffset(), "Size of input vector does not match the column ODD.");
+            STORM_LOG_ASSERT(result.size() == rowOdd.getTotalOffset(), "Size of result vector does not match the row ODD.");
+            internalAdd.multiplyWithExplicitVector(x, result, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices);
+        }
+        
         template<DdType LibraryType, typename ValueType>
         storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(std::set<storm::expressions::Variable> const& groupMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const {
             std::set<storm::expressions::Variable> rowMetaVariables;
@@ -628,6 +628,37 @@ namespace storm {
              */
             storm::storage::SparseMatrix<ValueType> toMatrix(std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const;
             
+            /*!
+             * Multiplies the ADD (interpreted as a matrix) with the given explicit vector and adds the result to the
+             * given explicit vector, i.e. computes result += A * x. In contrast to first converting the ADD to a
+             * (sparse) matrix, this keeps the matrix in its symbolic representation and uses the given offset-labeled
+             * DDs to map rows and columns to positions in the explicit vectors. Rows (columns) whose encoding is not
+             * contained in the row (column) ODD are ignored.
+             *
+             * @param x The explicit vector with which to multiply. Its size must match the column ODD.
+             * @param result The explicit vector to which the result is added. Its size must match the row ODD.
+             * @param rowMetaVariables The meta variables that encode the rows of the matrix.
+             * @param columnMetaVariables The meta variables that encode the columns of the matrix.
+             * @param rowOdd The ODD used for determining the correct row.
+             * @param columnOdd The ODD used for determining the correct column.
+             */
+            void multiplyWithExplicitVector(std::vector<ValueType> const& x, std::vector<ValueType>& result, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const;
+            
+            /*!
+             * Multiplies the ADD (interpreted as a matrix) with the given explicit vector and adds the result to the
+             * given explicit vector, i.e. computes result += A * x. This variant takes the (sorted) indices of the DD
+             * variables encoding rows and columns, which allows callers that multiply repeatedly to compute them
+             * only once.
+             *
+             * @param x The explicit vector with which to multiply. Its size must match the column ODD.
+             * @param result The explicit vector to which the result is added. Its size must match the row ODD.
+             * @param ddRowVariableIndices The sorted indices of the DD variables that encode the rows.
+             * @param ddColumnVariableIndices The sorted indices of the DD variables that encode the columns.
+             * @param rowOdd The ODD used for determining the correct row.
+             * @param columnOdd The ODD used for determining the correct column.
+             */
+            void multiplyWithExplicitVector(std::vector<ValueType> const& x, std::vector<ValueType>& result, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, storm::dd::Odd const& rowOdd, storm::dd::Odd const& columnOdd) const;
+            
             /*!
              * Converts the ADD to a row-grouped (sparse) matrix. The given offset-labeled DDs are used to
              * determine the correct row and column, respectively, for each entry. Note: this function assumes that
@@ -150,6 +150,11 @@ namespace storm {
             return quotient;
         }
         
+        template <storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
+        Partition<DdType, ValueType> const& BisimulationDecomposition<DdType, ValueType, ExportValueType>::getStatePartition() const {
+            return this->refiner->getStatePartition();
+        }
+        
         template <storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
         void BisimulationDecomposition<DdType, ValueType, ExportValueType>::refineWrtRewardModels() {
             for (auto const& rewardModelName : this->preservationInformation.getRewardModelNames()) {
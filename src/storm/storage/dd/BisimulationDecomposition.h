@@ -66,6 +66,12 @@ namespace storm {
              */
             std::shared_ptr<storm::models::Model<ExportValueType>> getQuotient() const;
             
+            /*!
+             * Retrieves the current state partition. After a fixpoint was reached, it can be used as the initial
+             * partition of later decompositions of the same model.
+             */
+            bisimulation::Partition<DdType, ValueType> const& getStatePartition() const;
+            
         private:
             void initialize();
             void refineWrtRewardModels();
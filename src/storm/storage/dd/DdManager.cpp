@@ -2,6 +2,10 @@
 
 #include "storm/storage/expressions/ExpressionManager.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/IOSettings.h"
+
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -18,8 +22,10 @@
 namespace storm {
     namespace dd {
         template<DdType LibraryType>
-        DdManager<LibraryType>::DdManager() : internalDdManager(), metaVariableMap(), manager(new storm::expressions::ExpressionManager()) {
-            // Intentionally left empty.
+        DdManager<LibraryType>::DdManager() : internalDdManager(), metaVariableMap(), manager(new storm::expressions::ExpressionManager()), statistics() {
+            bool showStatistics = storm::settings::hasModule<storm::settings::modules::CoreSettings>() && storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet();
+            bool exportStatistics = storm::settings::hasModule<storm::settings::modules::IOSettings>() && storm::settings::getModule<storm::settings::modules::IOSettings>().isExportDdStatisticsSet();
+            statistics.setEnabled(showStatistics || exportStatistics);
         }
         
         template<DdType LibraryType>
@@ -485,6 +491,31 @@ namespace storm {
             internalDdManager.debugCheck();
         }
         
+        template<DdType LibraryType>
+        DdStatistics& DdManager<LibraryType>::getStatistics() {
+            return statistics;
+        }
+        
+        template<DdType LibraryType>
+        DdStatistics const& DdManager<LibraryType>::getStatistics() const {
+            return statistics;
+        }
+        
+        template<DdType LibraryType>
+        DdLibraryStatistics DdManager<LibraryType>::getLibraryStatistics() const {
+            return internalDdManager.getLibraryStatistics();
+        }
+        
+        template<DdType LibraryType>
+        void DdManager<LibraryType>::printStatisticsToStream(std::ostream& out) const {
+            statistics.printToStream(out, this->getLibraryStatistics());
+        }
+        
+        template<DdType LibraryType>
+        void DdManager<LibraryType>::exportStatisticsToJson(std::ostream& out) const {
+            statistics.exportToJson(out, this->getLibraryStatistics());
+        }
+        
         template class DdManager<DdType::CUDD>;
         
         template Add<DdType::CUDD, double> DdManager<DdType::CUDD>::getAddZero() const;
@@ -6,6 +6,7 @@
 #include <boost/optional.hpp>
 
 #include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/DdStatistics.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/dd/MetaVariablePosition.h"
 #include "storm/storage/dd/Bdd.h"
@@ -321,6 +322,41 @@ namespace storm {
              * Performs a debug check if available.
              */
             void debugCheck() const;
+            
+            /*!
+             * Retrieves the statistics about the operations performed on the DDs of this manager.
+             *
+             * @return The statistics.
+             */
+            DdStatistics& getStatistics();
+            
+            /*!
+             * Retrieves the statistics about the operations performed on the DDs of this manager.
+             *
+             * @return The statistics.
+             */
+            DdStatistics const& getStatistics() const;
+            
+            /*!
+             * Retrieves the statistics reported by the underlying DD library.
+             *
+             * @return The library statistics.
+             */
+            DdLibraryStatistics getLibraryStatistics() const;
+            
+            /*!
+             * Prints the operation and library statistics to the given stream.
+             *
+             * @param out The stream to print to.
+             */
+            void printStatisticsToStream(std::ostream& out) const;
+            
+            /*!
+             * Writes the operation and library statistics as JSON to the given stream.
+             *
+             * @param out The stream to write to.
+             */
+            void exportStatisticsToJson(std::ostream& out) const;
 
         private:
             /*!
@@ -385,6 +421,9 @@ namespace storm {
             
             // The manager responsible for the variables.
             std::shared_ptr<storm::expressions::ExpressionManager> manager;
+            
+            // The statistics about the (expensive) operations performed on the DDs of this manager.
+            DdStatistics statistics;
         };
     }
 }
@@ -0,0 +1,148 @@
+#include "storm/storage/dd/DdStatistics.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+// JSON parser
+#include "json.hpp"
+namespace modernjson {
+    using json = nlohmann::json;
+}
+
+namespace storm {
+    namespace dd {
+
+        std::string toString(DdOperation const& operation) {
+            switch (operation) {
+                case DdOperation::MultiplyMatrix: return "multiplyMatrix";
+                case DdOperation::SumAbstract: return "sumAbstract";
+                case DdOperation::MinAbstract: return "minAbstract";
+                case DdOperation::MaxAbstract: return "maxAbstract";
+                case DdOperation::ExistsAbstract: return "existsAbstract";
+                case DdOperation::UniversalAbstract: return "universalAbstract";
+                case DdOperation::AndExists: return "andExists";
+                case DdOperation::RelationalProduct: return "relationalProduct";
+                case DdOperation::InverseRelationalProduct: return "inverseRelationalProduct";
+                case DdOperation::InverseRelationalProductWithExtendedRelation: return "inverseRelationalProductWithExtendedRelation";
+                case DdOperation::SwapVariables: return "swapVariables";
+            }
+            STORM_LOG_ASSERT(false, "Unknown DD operation.");
+            return "unknown";
+        }
+
+        DdLibraryStatistics::DdLibraryStatistics() : cacheLookups(0), cacheHits(0), cacheUsedSlots(0), cacheSlots(0), uniqueTableNodes(0), uniqueTableSlots(0), peakLiveNodes(0), garbageCollections(0), garbageCollectionMilliseconds(0), reorderings(0), reorderingMilliseconds(0), memoryInUse(0), processGlobal(false), cacheLookupsEstimated(false), memoryInUseEstimated(false) {
+            // Intentionally left empty.
+        }
+
+        DdStatistics::OperationStatistics::OperationStatistics() : numberOfCalls(0), numberOfResultNodes(0), maximalNumberOfResultNodes(0), time() {
+            // Intentionally left empty.
+        }
+
+        DdStatistics::DdStatistics(bool enabled) : enabled(enabled) {
+            // Intentionally left empty.
+        }
+
+        bool DdStatistics::isEnabled() const {
+            return enabled;
+        }
+
+        void DdStatistics::setEnabled(bool value) {
+            enabled = value;
+        }
+
+        void DdStatistics::recordOperation(DdOperation const& operation, storm::utility::Stopwatch const& watch, uint64_t numberOfResultNodes) {
+            OperationStatistics& statistics = operationStatistics[static_cast<uint64_t>(operation)];
+            ++statistics.numberOfCalls;
+            statistics.numberOfResultNodes += numberOfResultNodes;
+            statistics.maximalNumberOfResultNodes = std::max(statistics.maximalNumberOfResultNodes, numberOfResultNodes);
+            statistics.time.add(watch);
+        }
+
+        DdStatistics::OperationStatistics const& DdStatistics::getOperationStatistics(DdOperation const& operation) const {
+            return operationStatistics[static_cast<uint64_t>(operation)];
+        }
+
+        void DdStatistics::reset() {
+            for (auto& statistics : operationStatistics) {
+                statistics = OperationStatistics();
+            }
+        }
+
+        void DdStatistics::printToStream(std::ostream& out, DdLibraryStatistics const& libraryStatistics) const {
+            out << "DD statistics:" << std::endl;
+            if (libraryStatistics.processGlobal) {
+                out << "  (the library statistics are shared by all DD managers of the process)" << std::endl;
+            }
+            out << "  * cache hits/lookups: " << libraryStatistics.cacheHits << "/" << libraryStatistics.cacheLookups;
+            if (libraryStatistics.cacheLookups > 0) {
+                std::streamsize oldPrecision = out.precision(4);
+                out << " (" << (100.0 * libraryStatistics.cacheHits / libraryStatistics.cacheLookups) << "%)";
+                out.precision(oldPrecision);
+            }
+            if (libraryStatistics.cacheLookupsEstimated) {
+                out << " (lookups estimated)";
+            }
+            out << std::endl;
+            out << "  * cache slots used/available: " << libraryStatistics.cacheUsedSlots << "/" << libraryStatistics.cacheSlots << std::endl;
+            out << "  * unique table nodes/slots: " << libraryStatistics.uniqueTableNodes << "/" << libraryStatistics.uniqueTableSlots << std::endl;
+            out << "  * peak live nodes: " << libraryStatistics.peakLiveNodes << std::endl;
+            out << "  * garbage collections: " << libraryStatistics.garbageCollections << " (" << libraryStatistics.garbageCollectionMilliseconds << "ms)" << std::endl;
+            out << "  * reorderings: " << libraryStatistics.reorderings << " (" << libraryStatistics.reorderingMilliseconds << "ms)" << std::endl;
+            out << "  * memory in use: " << (libraryStatistics.memoryInUse / 1024 / 1024) << "MB" << (libraryStatistics.memoryInUseEstimated ? " (estimated)" : "") << std::endl;
+
+            bool printedHeader = false;
+            for (uint64_t index = 0; index < numberOfOperations; ++index) {
+                OperationStatistics const& statistics = operationStatistics[index];
+                if (statistics.numberOfCalls == 0) {
+                    continue;
+                }
+                if (!printedHeader) {
+                    out << "  * operations (calls, time, average/maximal result nodes):" << std::endl;
+                    printedHeader = true;
+                }
+                out << "    - " << toString(static_cast<DdOperation>(index)) << ": " << statistics.numberOfCalls << ", " << statistics.time << ", " << (statistics.numberOfResultNodes / statistics.numberOfCalls) << "/" << statistics.maximalNumberOfResultNodes << std::endl;
+            }
+        }
+
+        void DdStatistics::exportToJson(std::ostream& out, DdLibraryStatistics const& libraryStatistics) const {
+            modernjson::json library;
+            library["cache-lookups"] = libraryStatistics.cacheLookups;
+            library["cache-hits"] = libraryStatistics.cacheHits;
+            library["cache-used-slots"] = libraryStatistics.cacheUsedSlots;
+            library["cache-slots"] = libraryStatistics.cacheSlots;
+            library["unique-table-nodes"] = libraryStatistics.uniqueTableNodes;
+            library["unique-table-slots"] = libraryStatistics.uniqueTableSlots;
+            library["peak-live-nodes"] = libraryStatistics.peakLiveNodes;
+            library["garbage-collections"] = libraryStatistics.garbageCollections;
+            library["garbage-collection-time-ms"] = libraryStatistics.garbageCollectionMilliseconds;
+            library["reorderings"] = libraryStatistics.reorderings;
+            library["reordering-time-ms"] = libraryStatistics.reorderingMilliseconds;
+            library["memory-in-use"] = libraryStatistics.memoryInUse;
+            library["process-global"] = libraryStatistics.processGlobal;
+            library["cache-lookups-estimated"] = libraryStatistics.cacheLookupsEstimated;
+            library["memory-in-use-estimated"] = libraryStatistics.memoryInUseEstimated;
+
+            modernjson::json operations;
+            for (uint64_t index = 0; index < numberOfOperations; ++index) {
+                OperationStatistics const& statistics = operationStatistics[index];
+                modernjson::json operation;
+                operation["calls"] = statistics.numberOfCalls;
+                operation["time-ms"] = statistics.time.getTimeInMilliseconds();
+                operation["result-nodes"] = statistics.numberOfResultNodes;
+                operation["maximal-result-nodes"] = statistics.maximalNumberOfResultNodes;
+                operations[toString(static_cast<DdOperation>(index))] = operation;
+            }
+
+            modernjson::json result;
+            result["library"] = library;
+            result["operations"] = operations;
+            out << result.dump(4) << std::endl;
+        }
+
+        DdOperationWatch::DdOperationWatch(DdStatistics& statistics, DdOperation const& operation) : statistics(statistics), operation(operation), watch(statistics.isEnabled()) {
+            // Intentionally left empty.
+        }
+
+    }
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "storm/utility/Stopwatch.h"
+
+namespace storm {
+    namespace dd {
+
+        /*!
+         * The DD operations for which statistics are collected.
+         */
+        enum class DdOperation {
+            MultiplyMatrix,
+            SumAbstract,
+            MinAbstract,
+            MaxAbstract,
+            ExistsAbstract,
+            UniversalAbstract,
+            AndExists,
+            RelationalProduct,
+            InverseRelationalProduct,
+            InverseRelationalProductWithExtendedRelation,
+            SwapVariables
+        };
+
+        std::string toString(DdOperation const& operation);
+
+        /*!
+         * Statistics that are reported by the underlying DD library. Entries that a library does not provide are
+         * left at zero.
+         */
+        struct DdLibraryStatistics {
+            DdLibraryStatistics();
+
+            // The number of lookups in and hits of the computed table (operation cache).
+            uint64_t cacheLookups;
+            uint64_t cacheHits;
+
+            // The number of used and available slots in the computed table.
+            uint64_t cacheUsedSlots;
+            uint64_t cacheSlots;
+
+            // The number of nodes currently stored in and the capacity of the unique table.
+            uint64_t uniqueTableNodes;
+            uint64_t uniqueTableSlots;
+
+            // The peak number of live nodes.
+            uint64_t peakLiveNodes;
+
+            // Information about the garbage collections performed.
+            uint64_t garbageCollections;
+            uint64_t garbageCollectionMilliseconds;
+
+            // Information about the reorderings performed.
+            uint64_t reorderings;
+            uint64_t reorderingMilliseconds;
+
+            // The memory (in bytes) currently used by the library.
+            uint64_t memoryInUse;
+            
+            // Whether the statistics are maintained for the whole process (rather than for the particular manager),
+            // i.e. whether all managers report the same values.
+            bool processGlobal;
+            
+            // Whether the number of cache lookups and the memory in use are only estimated (e.g. derived from other
+            // counters or the table sizes) instead of being reported by the library.
+            bool cacheLookupsEstimated;
+            bool memoryInUseEstimated;
+        };
+
+        /*!
+         * Collects statistics about the (expensive) DD operations performed by the DDs of one manager.
+         */
+        class DdStatistics {
+        public:
+            struct OperationStatistics {
+                OperationStatistics();
+
+                // The number of times the operation was called.
+                uint64_t numberOfCalls;
+
+                // The total and maximal number of nodes of the results of the operation.
+                uint64_t numberOfResultNodes;
+                uint64_t maximalNumberOfResultNodes;
+
+                // The total time spent in the operation.
+                storm::utility::Stopwatch time;
+            };
+
+            /*!
+             * Creates statistics that are collected iff the flag is set.
+             */
+            DdStatistics(bool enabled = false);
+
+            /*!
+             * Retrieves whether statistics are currently collected.
+             */
+            bool isEnabled() const;
+
+            /*!
+             * Sets whether statistics are collected.
+             */
+            void setEnabled(bool value);
+
+            /*!
+             * Records one call to the given operation.
+             *
+             * @param operation The operation that was performed.
+             * @param watch A (stopped) stopwatch measuring the time spent in the operation.
+             * @param numberOfResultNodes The number of nodes of the result of the operation.
+             */
+            void recordOperation(DdOperation const& operation, storm::utility::Stopwatch const& watch, uint64_t numberOfResultNodes);
+
+            /*!
+             * Retrieves the statistics collected for the given operation.
+             */
+            OperationStatistics const& getOperationStatistics(DdOperation const& operation) const;
+
+            /*!
+             * Resets all collected statistics.
+             */
+            void reset();
+
+            /*!
+             * Prints the collected statistics together with the given library statistics in human-readable form.
+             */
+            void printToStream(std::ostream& out, DdLibraryStatistics const& libraryStatistics) const;
+
+            /*!
+             * Writes the collected statistics together with the given library statistics as a JSON object.
+             */
+            void exportToJson(std::ostream& out, DdLibraryStatistics const& libraryStatistics) const;
+
+        private:
+            static const uint64_t numberOfOperations = static_cast<uint64_t>(DdOperation::SwapVariables) + 1;
+
+            // A flag indicating whether statistics are collected.
+            bool enabled;
+
+            // The statistics per operation (indexed by the operation).
+            std::array<OperationStatistics, numberOfOperations> operationStatistics;
+        };
+
+        /*!
+         * Measures a single DD operation and records it in the given statistics upon completion. If the statistics
+         * are disabled, this does not cause any overhead apart from checking the flag.
+         */
+        class DdOperationWatch {
+        public:
+            DdOperationWatch(DdStatistics& statistics, DdOperation const& operation);
+
+            /*!
+             * Stops the measurement and records the operation with the given result.
+             *
+             * @param result The result of the operation.
+             * @return The given result.
+             */
+            template<typename DdResultType>
+            DdResultType finish(DdResultType result) {
+                if (statistics.isEnabled()) {
+                    watch.stop();
+                    statistics.recordOperation(operation, watch, result.getNodeCount());
+                }
+                return result;
+            }
+
+        private:
+            DdStatistics& statistics;
+            DdOperation operation;
+            storm::utility::Stopwatch watch;
+        };
+
+    }
+}
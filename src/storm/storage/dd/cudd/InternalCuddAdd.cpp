@@ -683,6 +683,58 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void InternalAdd<DdType::CUDD, ValueType>::multiplyWithExplicitVector(std::vector<ValueType> const& x, std::vector<ValueType>& result, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices) const {
+            STORM_LOG_ASSERT(ddRowVariableIndices.size() == ddColumnVariableIndices.size(), "Expected the same number of row and column variables.");
+            multiplyWithExplicitVectorRec(this->getCuddDdNode(), x, result, rowOdd, columnOdd, 0, ddRowVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices);
+        }
+        
+        template<typename ValueType>
+        void InternalAdd<DdType::CUDD, ValueType>::multiplyWithExplicitVectorRec(DdNode const* dd, std::vector<ValueType> const& x, std::vector<ValueType>& result, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices) const {
+            // If the DD is empty or there are no valid rows or columns below this point, there is nothing to add.
+            if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager()) || rowOdd.getTotalOffset() == 0 || columnOdd.getTotalOffset() == 0) {
+                return;
+            }
+            
+            // If we are at the maximal level, the value is stored as a constant in the DD.
+            if (currentLevel == maxLevel) {
+                result[currentRowOffset] += storm::utility::convertNumber<ValueType>(Cudd_V(dd)) * x[currentColumnOffset];
+            } else {
+                DdNode const* elseElse;
+                DdNode const* elseThen;
+                DdNode const* thenElse;
+                DdNode const* thenThen;
+                
+                if (ddColumnVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
+                    elseElse = elseThen = thenElse = thenThen = dd;
+                } else if (ddRowVariableIndices[currentLevel] < Cudd_NodeReadIndex(dd)) {
+                    elseElse = thenElse = Cudd_E_const(dd);
+                    elseThen = thenThen = Cudd_T_const(dd);
+                } else {
+                    DdNode const* elseNode = Cudd_E_const(dd);
+                    if (ddColumnVariableIndices[currentLevel] < Cudd_NodeReadIndex(elseNode)) {
+                        elseElse = elseThen = elseNode;
+                    } else {
+                        elseElse = Cudd_E_const(elseNode);
+                        elseThen = Cudd_T_const(elseNode);
+                    }
+                    
+                    DdNode const* thenNode = Cudd_T_const(dd);
+                    if (ddColumnVariableIndices[currentLevel] < Cudd_NodeReadIndex(thenNode)) {
+                        thenElse = thenThen = thenNode;
+                    } else {
+                        thenElse = Cudd_E_const(thenNode);
+                        thenThen = Cudd_T_const(thenNode);
+                    }
+                }
+                
+                multiplyWithExplicitVectorRec(elseElse, x, result, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices);
+                multiplyWithExplicitVectorRec(elseThen, x, result, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices);
+                multiplyWithExplicitVectorRec(thenElse, x, result, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices);
+                multiplyWithExplicitVectorRec(thenThen, x, result, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices);
+            }
+        }
+        
         template<typename ValueType>
         InternalAdd<DdType::CUDD, ValueType> InternalAdd<DdType::CUDD, ValueType>::fromVector(InternalDdManager<DdType::CUDD> const* ddManager, std::vector<ValueType> const& values, storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices) {
             uint_fast64_t offset = 0;
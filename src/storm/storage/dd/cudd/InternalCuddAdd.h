@@ -618,6 +618,20 @@ namespace storm {
              */
             void toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
             
+            /*!
+             * Multiplies the ADD (interpreted as a matrix) with the given explicit vector and adds the result to the
+             * given explicit result vector, i.e. computes result += A * x, without translating the ADD into an
+             * explicit matrix. Rows (columns) whose encoding is not contained in the row (column) ODD are ignored.
+             *
+             * @param x The explicit vector with which to multiply.
+             * @param result The explicit vector to which the result is added.
+             * @param rowOdd The ODD used for translating the rows.
+             * @param columnOdd The ODD used for translating the columns.
+             * @param ddRowVariableIndices The variable indices of the row variables.
+             * @param ddColumnVariableIndices The variable indices of the column variables.
+             */
+            void multiplyWithExplicitVector(std::vector<ValueType> const& x, std::vector<ValueType>& result, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices) const;
+            
             /*!
              * Creates an ADD from the given explicit vector.
              *
@@ -737,6 +751,24 @@ namespace storm {
              */
             void toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications, std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
             
+            /*!
+             * Helper function that recursively multiplies the given DD (interpreted as a matrix) with the explicit
+             * vector and adds the result to the explicit result vector.
+             *
+             * @param dd The DD to multiply.
+             * @param x The explicit vector with which to multiply.
+             * @param result The explicit vector to which the result is added.
+             * @param rowOdd The ODD used for the row translation.
+             * @param columnOdd The ODD used for the column translation.
+             * @param currentLevel The currently considered (row and column) level in the DD.
+             * @param maxLevel The number of levels that need to be considered.
+             * @param currentRowOffset The current row offset.
+             * @param currentColumnOffset The current column offset.
+             * @param ddRowVariableIndices The (sorted) indices of all DD row variables that need to be considered.
+             * @param ddColumnVariableIndices The (sorted) indices of all DD column variables that need to be considered.
+             */
+            void multiplyWithExplicitVectorRec(DdNode const* dd, std::vector<ValueType> const& x, std::vector<ValueType>& result, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices) const;
+            
             /*!
              * Builds an ADD representing the given vector.
              *
@@ -157,6 +157,27 @@ namespace storm {
             this->getCuddManager().DebugCheck();
         }
         
+        DdLibraryStatistics InternalDdManager<DdType::CUDD>::getLibraryStatistics() const {
+            DdLibraryStatistics result;
+            ::DdManager* manager = this->getCuddManager().getManager();
+            
+            result.cacheLookups = static_cast<uint64_t>(Cudd_ReadCacheLookUps(manager));
+            result.cacheHits = static_cast<uint64_t>(Cudd_ReadCacheHits(manager));
+            result.cacheSlots = Cudd_ReadCacheSlots(manager);
+            // CUDD only reports the fraction of used cache slots.
+            result.cacheUsedSlots = static_cast<uint64_t>(Cudd_ReadCacheUsedSlots(manager) * result.cacheSlots);
+            result.uniqueTableNodes = Cudd_ReadKeys(manager);
+            result.uniqueTableSlots = Cudd_ReadSlots(manager);
+            result.peakLiveNodes = static_cast<uint64_t>(Cudd_ReadPeakLiveNodeCount(manager));
+            result.garbageCollections = static_cast<uint64_t>(Cudd_ReadGarbageCollections(manager));
+            result.garbageCollectionMilliseconds = static_cast<uint64_t>(Cudd_ReadGarbageCollectionTime(manager));
+            result.reorderings = Cudd_ReadReorderings(manager);
+            result.reorderingMilliseconds = static_cast<uint64_t>(Cudd_ReadReorderingTime(manager));
+            result.memoryInUse = Cudd_ReadMemoryInUse(manager);
+            
+            return result;
+        }
+        
         cudd::Cudd& InternalDdManager<DdType::CUDD>::getCuddManager() {
             return cuddManager;
         }
@@ -5,6 +5,7 @@
 
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalDdManager.h"
+#include "storm/storage/dd/DdStatistics.h"
 
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
@@ -131,6 +132,13 @@ namespace storm {
              */
             void debugCheck() const;
             
+            /*!
+             * Retrieves the statistics collected by the underlying DD library.
+             *
+             * @return The library statistics.
+             */
+            DdLibraryStatistics getLibraryStatistics() const;
+            
             /*!
              * Retrieves the number of DD variables managed by this manager.
              *
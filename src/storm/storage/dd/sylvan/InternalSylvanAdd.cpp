@@ -1113,6 +1113,58 @@ namespace storm {
             }
         }
         
+        template<typename ValueType>
+        void InternalAdd<DdType::Sylvan, ValueType>::multiplyWithExplicitVector(std::vector<ValueType> const& x, std::vector<ValueType>& result, Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices) const {
+            STORM_LOG_ASSERT(ddRowVariableIndices.size() == ddColumnVariableIndices.size(), "Expected the same number of row and column variables.");
+            multiplyWithExplicitVectorRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), x, result, rowOdd, columnOdd, 0, ddRowVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices);
+        }
+        
+        template<typename ValueType>
+        void InternalAdd<DdType::Sylvan, ValueType>::multiplyWithExplicitVectorRec(MTBDD dd, bool negated, std::vector<ValueType> const& x, std::vector<ValueType>& result, Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices) const {
+            // If the DD is empty or there are no valid rows or columns below this point, there is nothing to add.
+            if ((mtbdd_isleaf(dd) && mtbdd_iszero(dd)) || rowOdd.getTotalOffset() == 0 || columnOdd.getTotalOffset() == 0) {
+                return;
+            }
+            
+            // If we are at the maximal level, the value is stored as a constant in the DD.
+            if (currentLevel == maxLevel) {
+                result[currentRowOffset] += (negated ? -getValue(dd) : getValue(dd)) * x[currentColumnOffset];
+            } else {
+                MTBDD elseElse;
+                MTBDD elseThen;
+                MTBDD thenElse;
+                MTBDD thenThen;
+                
+                if (mtbdd_isleaf(dd) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+                    elseElse = elseThen = thenElse = thenThen = dd;
+                } else if (ddRowVariableIndices[currentLevel] < mtbdd_getvar(dd)) {
+                    elseElse = thenElse = mtbdd_getlow(dd);
+                    elseThen = thenThen = mtbdd_gethigh(dd);
+                } else {
+                    MTBDD elseNode = mtbdd_getlow(dd);
+                    if (mtbdd_isleaf(elseNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(elseNode)) {
+                        elseElse = elseThen = elseNode;
+                    } else {
+                        elseElse = mtbdd_getlow(elseNode);
+                        elseThen = mtbdd_gethigh(elseNode);
+                    }
+                    
+                    MTBDD thenNode = mtbdd_gethigh(dd);
+                    if (mtbdd_isleaf(thenNode) || ddColumnVariableIndices[currentLevel] < mtbdd_getvar(thenNode)) {
+                        thenElse = thenThen = thenNode;
+                    } else {
+                        thenElse = mtbdd_getlow(thenNode);
+                        thenThen = mtbdd_gethigh(thenNode);
+                    }
+                }
+                
+                multiplyWithExplicitVectorRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, x, result, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices);
+                multiplyWithExplicitVectorRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, x, result, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices);
+                multiplyWithExplicitVectorRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, x, result, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices);
+                multiplyWithExplicitVectorRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, x, result, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices);
+            }
+        }
+        
         template<typename ValueType>
         InternalAdd<DdType::Sylvan, ValueType> InternalAdd<DdType::Sylvan, ValueType>::fromVector(InternalDdManager<DdType::Sylvan> const* ddManager, std::vector<ValueType> const& values, storm::dd::Odd const& odd, std::vector<uint_fast64_t> const& ddVariableIndices) {
             uint_fast64_t offset = 0;
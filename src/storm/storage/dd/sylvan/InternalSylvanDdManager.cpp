@@ -13,6 +13,8 @@
 
 #include "storm/utility/sylvan.h"
 
+#include "sylvan_cache.h"
+
 #include "storm-config.h"
 
 namespace storm {
@@ -258,6 +260,42 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
         }
         
+        DdLibraryStatistics InternalDdManager<DdType::Sylvan>::getLibraryStatistics() const {
+            DdLibraryStatistics result;
+            
+            // Sylvan keeps its tables and counters for the whole process, so they are shared by all managers.
+            result.processGlobal = true;
+            
+            LACE_ME;
+            size_t filledTableSlots = 0;
+            size_t totalTableSlots = 0;
+            sylvan_table_usage(&filledTableSlots, &totalTableSlots);
+            result.uniqueTableNodes = filledTableSlots;
+            result.uniqueTableSlots = totalTableSlots;
+            result.cacheUsedSlots = cache_getused();
+            result.cacheSlots = cache_getsize();
+            
+            // Sylvan does not report its memory usage, so we estimate it from the table sizes. Node and cache entries
+            // take 24 and 36 bytes, respectively (see table/cache size computation).
+            result.memoryInUse = totalTableSlots * 24 + result.cacheSlots * 36;
+            result.memoryInUseEstimated = true;
+            
+            // Note that the counters and timers are only maintained if sylvan was built with SYLVAN_STATS.
+            sylvan_stats_t stats;
+            sylvan_stats_snapshot(&stats);
+            for (int counter = BDD_ITE; counter < SYLVAN_GC_COUNT; counter += 3) {
+                // Each operation has a counter for the calls, the cache insertions and the cache hits (in that order).
+                // Sylvan does not count the cache lookups, so we use the (non-trivial) calls, which mostly perform one.
+                result.cacheLookups += stats.counters[counter];
+                result.cacheHits += stats.counters[counter + 2];
+            }
+            result.cacheLookupsEstimated = true;
+            result.garbageCollections = stats.counters[SYLVAN_GC_COUNT];
+            result.garbageCollectionMilliseconds = stats.timers[SYLVAN_GC] / 1000000;
+            
+            return result;
+        }
+        
         uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfDdVariables() const {
             return nextFreeVariableIndex;
         }
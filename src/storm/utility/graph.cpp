@@ -983,8 +983,7 @@ namespace storm {
                 uint_fast64_t iterations = 0;
                 while (lastIterationStates != statesWithProbability1A) {
                     lastIterationStates = statesWithProbability1A;
-                    statesWithProbability1A = statesWithProbability1A.swapVariables(model.getRowColumnMetaVariablePairs());
-                    statesWithProbability1A = transitionMatrix.implies(statesWithProbability1A).universalAbstract(model.getColumnVariables());
+                    statesWithProbability1A = !transitionMatrix.andExists(!statesWithProbability1A.swapVariables(model.getRowColumnMetaVariablePairs()), model.getColumnVariables());
                     statesWithProbability1A |= model.getIllegalMask();
                     statesWithProbability1A = statesWithProbability1A.universalAbstract(model.getNondeterminismVariables());
                     statesWithProbability1A &= statesWithProbabilityGreater0A;
@@ -1006,14 +1005,16 @@ namespace storm {
                 while (!outerLoopDone) {
                     storm::dd::Bdd<Type> innerStates = manager.getBddZero();
                     
+                    // The choices that stay within the current candidate states do not change in the inner loop, so
+                    // we compute them only once. Note that (forall s': T(s,a,s') -> X(s')) equals
+                    // !(exists s': T(s,a,s') && !X(s')), which can be computed by a single (parallel) and-exists.
+                    storm::dd::Bdd<Type> choicesStayingInStates = !transitionMatrix.andExists(!statesWithProbability1E.swapVariables(model.getRowColumnMetaVariablePairs()), model.getColumnVariables());
+                    
                     bool innerLoopDone = false;
                     while (!innerLoopDone) {
-                        storm::dd::Bdd<Type> temporary = statesWithProbability1E.swapVariables(model.getRowColumnMetaVariablePairs());
-                        temporary = transitionMatrix.implies(temporary).universalAbstract(model.getColumnVariables());
-                        
                         storm::dd::Bdd<Type> temporary2 = innerStates.inverseRelationalProductWithExtendedRelation(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
                         
-                        temporary = temporary.andExists(temporary2, model.getNondeterminismVariables());
+                        storm::dd::Bdd<Type> temporary = choicesStayingInStates.andExists(temporary2, model.getNondeterminismVariables());
                         temporary &= phiStates;
                         temporary |= psiStates;
                         
@@ -1043,14 +1044,14 @@ namespace storm {
 
                 storm::dd::Bdd<Type> innerStates = manager.getBddZero();
                 
+                // The choices that stay within the states with probability 1 do not change during the iteration.
+                storm::dd::Bdd<Type> choicesStayingInStates = !transitionMatrix.andExists(!statesWithProbability1E.swapVariables(model.getRowColumnMetaVariablePairs()), model.getColumnVariables());
+                
                 uint64_t iterations = 0;
                 bool innerLoopDone = false;
                 while (!innerLoopDone) {
-                    storm::dd::Bdd<Type> temporary = statesWithProbability1E.swapVariables(model.getRowColumnMetaVariablePairs());
-                    temporary = transitionMatrix.implies(temporary).universalAbstract(model.getColumnVariables());
-                    
                     storm::dd::Bdd<Type> temporary2 = innerStates.inverseRelationalProductWithExtendedRelation(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
-                    temporary &= temporary2;
+                    storm::dd::Bdd<Type> temporary = choicesStayingInStates && temporary2;
                     temporary &= phiStates;
 
                     // Extend the scheduler for those states that have not been seen as inner states before.
@@ -37,6 +37,7 @@ namespace storm {
             bool eliminationOrderNeedsForwardDistances(storm::settings::modules::EliminationSettings::EliminationOrder const& order);
             bool eliminationOrderNeedsReversedDistances(storm::settings::modules::EliminationSettings::EliminationOrder const& order);
             bool eliminationOrderIsPenaltyBased(storm::settings::modules::EliminationSettings::EliminationOrder const& order);
+            bool eliminationOrderIsFillReducing(storm::settings::modules::EliminationSettings::EliminationOrder const& order);
             bool eliminationOrderIsStatic(storm::settings::modules::EliminationSettings::EliminationOrder const& order);
             
             template<typename ValueType>
@@ -53,8 +54,13 @@ namespace storm {
             template<typename ValueType>
             uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state_type const& state, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities);
             
+            /*!
+             * Creates the priority queue for eliminating the given states in the order selected in the settings. If
+             * statistics are to be shown, a fill-reducing order is selected and predictedFillIn is given, the predicted
+             * fill-in of the order (in undirected transitions) is added to predictedFillIn.
+             */
             template<typename ValueType>
-            std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states);
+            std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances, storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& oneStepProbabilities, storm::storage::BitVector const& states, uint64_t* predictedFillIn = nullptr);
             
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(storm::storage::BitVector const& states);
             std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(std::vector<storm::storage::sparse::state_type> const& states);
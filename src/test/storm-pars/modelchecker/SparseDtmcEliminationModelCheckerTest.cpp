@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/logic/Formulas.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/utility/prism.h"
+#include "storm/utility/constants.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/EliminationSettings.h"
+
+namespace {
+
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> buildParametricDtmc(std::string const& programFile, std::string const& constantsAsString = "") {
+        storm::prism::Program program = storm::parser::PrismParser::parse(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        storm::generator::NextStateGeneratorOptions options;
+        options.setBuildAllLabels().setBuildAllRewardModels();
+        std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> model = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build();
+        return model->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    }
+
+    std::vector<storm::RationalFunction> checkAll(storm::models::sparse::Dtmc<storm::RationalFunction> const& dtmc, std::vector<std::string> const& formulasAsString) {
+        storm::parser::FormulaParser formulaParser(std::make_shared<storm::expressions::ExpressionManager>());
+        storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>> checker(dtmc);
+        uint64_t initialState = *dtmc.getInitialStates().begin();
+
+        std::vector<storm::RationalFunction> results;
+        for (auto const& formulaAsString : formulasAsString) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulaParser.parseSingleFormulaFromString(formulaAsString), true));
+            results.push_back(result->asExplicitQuantitativeCheckResult<storm::RationalFunction>()[initialState]);
+        }
+        return results;
+    }
+
+    TEST(SparseDtmcEliminationModelCheckerTest, Die_ArithmeticCache) {
+        auto dtmc = buildParametricDtmc(STORM_TEST_RESOURCES_DIR "/pdtmc/parametric_die.pm");
+        std::vector<std::string> formulas = {"P=? [F \"one\"]", "R=? [F \"done\"]", "P=? [F \"one\" || F \"done\"]", "LRA=? [\"done\"]"};
+
+        std::vector<storm::RationalFunction> uncachedResults = checkAll(*dtmc, formulas);
+        std::vector<storm::RationalFunction> cachedResults;
+        {
+            std::unique_ptr<storm::settings::SettingMemento> useArithmeticCache = storm::settings::mutableModule<storm::settings::modules::EliminationSettings>().overrideUseArithmeticCacheSet(true);
+            cachedResults = checkAll(*dtmc, formulas);
+        }
+
+        ASSERT_EQ(uncachedResults.size(), cachedResults.size());
+        for (uint64_t index = 0; index < uncachedResults.size(); ++index) {
+            EXPECT_EQ(uncachedResults[index], cachedResults[index]) << "for formula " << formulas[index];
+        }
+    }
+
+    TEST(SparseDtmcEliminationModelCheckerTest, Crowds_ArithmeticCache) {
+        auto dtmc = buildParametricDtmc(STORM_TEST_RESOURCES_DIR "/pdtmc/crowds3_5.pm");
+        std::vector<std::string> formulas = {"P=? [F \"observe0Greater1\"]", "P=? [F \"observeIGreater1\" || F \"observe0Greater1\"]"};
+
+        std::vector<storm::RationalFunction> uncachedResults = checkAll(*dtmc, formulas);
+        std::vector<storm::RationalFunction> cachedResults;
+        {
+            std::unique_ptr<storm::settings::SettingMemento> useArithmeticCache = storm::settings::mutableModule<storm::settings::modules::EliminationSettings>().overrideUseArithmeticCacheSet(true);
+            cachedResults = checkAll(*dtmc, formulas);
+        }
+
+        ASSERT_EQ(uncachedResults.size(), cachedResults.size());
+        for (uint64_t index = 0; index < uncachedResults.size(); ++index) {
+            EXPECT_EQ(uncachedResults[index], cachedResults[index]) << "for formula " << formulas[index];
+        }
+    }
+
+    TEST(SparseDtmcEliminationModelCheckerTest, Crowds_Threads) {
+        auto dtmc = buildParametricDtmc(STORM_TEST_RESOURCES_DIR "/pdtmc/crowds3_5.pm");
+        std::vector<std::string> formulas = {"P=? [F \"observe0Greater1\"]", "P=? [F \"observeIGreater1\"]"};
+
+        // Small SCCs force the hybrid elimination to descend into several independent sub-SCCs. (Rational functions
+        // over CLN numbers are always eliminated sequentially.)
+        storm::settings::modules::EliminationSettings& eliminationSettings = storm::settings::mutableModule<storm::settings::modules::EliminationSettings>();
+        std::unique_ptr<storm::settings::SettingMemento> hybridElimination = eliminationSettings.overrideEliminationMethod(storm::settings::modules::EliminationSettings::EliminationMethod::Hybrid);
+        std::unique_ptr<storm::settings::SettingMemento> maximalSccSize = eliminationSettings.overrideMaximalSccSize(2);
+
+        std::vector<storm::RationalFunction> sequentialResults = checkAll(*dtmc, formulas);
+        for (uint64_t numberOfThreads : {2, 4}) {
+            std::unique_ptr<storm::settings::SettingMemento> threads = eliminationSettings.overrideNumberOfThreads(numberOfThreads);
+            std::vector<storm::RationalFunction> concurrentResults = checkAll(*dtmc, formulas);
+
+            // The states are eliminated in a different order, so the results may differ in their representation.
+            ASSERT_EQ(sequentialResults.size(), concurrentResults.size());
+            for (uint64_t index = 0; index < sequentialResults.size(); ++index) {
+                EXPECT_TRUE(storm::utility::isZero(sequentialResults[index] - concurrentResults[index])) << "for formula " << formulas[index] << " and " << numberOfThreads << " threads";
+            }
+        }
+    }
+
+}
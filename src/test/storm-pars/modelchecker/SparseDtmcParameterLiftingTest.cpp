@@ -12,6 +12,11 @@
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/storage/jani/Property.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm-pars/settings/modules/RegionSettings.h"
+#include "storm/exceptions/InvalidSettingsException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 
 namespace {
@@ -325,6 +330,49 @@ namespace {
         
     }
     
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Rew_Monotonicity) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp_rewards16_2.pm";
+        std::string formulaAsString = "R>2.5 [F ((s=5) | (s=0&srep=3)) ]";
+        std::string constantsAsString = ""; //!! this model will have 4 parameters
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+        
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        auto monotoneRegionChecker = [&] () {
+            std::unique_ptr<storm::settings::SettingMemento> useMonotonicity = storm::settings::mutableModule<storm::settings::modules::RegionSettings>().overrideUseMonotonicitySet(true);
+            return storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        }();
+        
+        //start testing
+        auto allSatRegion=storm::api::parseRegion<storm::RationalFunction>("0.7<=pK<=0.9,0.6<=pL<=0.85,0.9<=TOMsg<=0.95,0.85<=TOAck<=0.9", modelParameters);
+        auto exBothRegion=storm::api::parseRegion<storm::RationalFunction>("0.1<=pK<=0.7,0.2<=pL<=0.8,0.15<=TOMsg<=0.65,0.3<=TOAck<=0.9", modelParameters);
+        auto allVioRegion=storm::api::parseRegion<storm::RationalFunction>("0.1<=pK<=0.4,0.2<=pL<=0.3,0.15<=TOMsg<=0.3,0.1<=TOAck<=0.2", modelParameters);
+        
+        for (auto const& region : {allSatRegion, exBothRegion, allVioRegion}) {
+            EXPECT_EQ(regionChecker->analyzeRegion(this->env(), region, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true), monotoneRegionChecker->analyzeRegion(this->env(), region, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true)) << "for region " << region;
+        }
+        
+        // The rewards are monotonically increasing in TOMsg and TOAck. Not lifting these parameters yields bounds that are at least as tight.
+        for (auto const& region : {allSatRegion, exBothRegion, allVioRegion}) {
+            double lowerBound = storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), region, storm::OptimizationDirection::Minimize));
+            double upperBound = storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), region, storm::OptimizationDirection::Maximize));
+            double monotoneLowerBound = storm::utility::convertNumber<double>(monotoneRegionChecker->getBoundAtInitState(this->env(), region, storm::OptimizationDirection::Minimize));
+            double monotoneUpperBound = storm::utility::convertNumber<double>(monotoneRegionChecker->getBoundAtInitState(this->env(), region, storm::OptimizationDirection::Maximize));
+            EXPECT_LE(lowerBound, monotoneLowerBound + 1e-6) << "for region " << region;
+            EXPECT_LE(monotoneLowerBound, monotoneUpperBound + 1e-6) << "for region " << region;
+            EXPECT_LE(monotoneUpperBound, upperBound + 1e-6) << "for region " << region;
+        }
+    }
+    
     TYPED_TEST(SparseDtmcParameterLiftingTest, Crowds_Prob) {
         typedef typename TestFixture::ValueType ValueType;
         
@@ -356,6 +404,57 @@ namespace {
     
     }
     
+    TYPED_TEST(SparseDtmcParameterLiftingTest, Crowds_Prob_RefinementThreads) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/crowds3_5.pm";
+        std::string formulaAsString = "P<0.5 [F \"observe0Greater1\" ]";
+        std::string constantsAsString = ""; //e.g. pL=0.9,TOACK=0.5
+        
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+        
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=PF<=0.95,0.15<=badC<=0.9", modelParameters);
+        
+        // Without a coverage threshold, the refinement depth alone determines which regions are analyzed, so the
+        // number of threads must not change the result.
+        storm::settings::modules::RegionSettings& regionSettings = storm::settings::mutableModule<storm::settings::modules::RegionSettings>();
+        auto refine = [&] () {
+            auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+            return regionChecker->performRegionRefinement(this->env(), region, boost::none, 3);
+        };
+        
+        EXPECT_EQ(1ull, regionSettings.getNumberOfRefinementThreads());
+        auto sequentialResult = refine();
+        for (uint64_t numberOfThreads : {2, 3}) {
+            std::unique_ptr<storm::settings::SettingMemento> refinementThreads = regionSettings.overrideNumberOfRefinementThreads(numberOfThreads);
+            EXPECT_EQ(numberOfThreads, regionSettings.getNumberOfRefinementThreads());
+#ifdef STORM_USE_CLN_RF
+            // Rational functions over CLN numbers must not be shared between threads.
+            EXPECT_THROW(regionSettings.check(), storm::exceptions::InvalidSettingsException);
+            EXPECT_THROW(refine(), storm::exceptions::NotSupportedException);
+#else
+            auto concurrentResult = refine();
+        
+            auto const& sequentialRegionResults = sequentialResult->getRegionResults();
+            auto const& concurrentRegionResults = concurrentResult->getRegionResults();
+            ASSERT_EQ(sequentialRegionResults.size(), concurrentRegionResults.size()) << "for " << numberOfThreads << " threads";
+            for (uint64_t index = 0; index < sequentialRegionResults.size(); ++index) {
+                EXPECT_EQ(sequentialRegionResults[index].first.toString(), concurrentRegionResults[index].first.toString()) << "for " << numberOfThreads << " threads";
+                EXPECT_EQ(sequentialRegionResults[index].second, concurrentRegionResults[index].second) << "for region " << sequentialRegionResults[index].first << " and " << numberOfThreads << " threads";
+            }
+#endif
+        }
+        EXPECT_EQ(1ull, regionSettings.getNumberOfRefinementThreads());
+    }
+    
     TYPED_TEST(SparseDtmcParameterLiftingTest, Crowds_Prob_stepBounded) {
         typedef typename TestFixture::ValueType ValueType;
         
@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseMdpInstantiationModelChecker.h"
+#include "storm-pars/utility/parametric.h"
+#include "storm/api/storm.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+
+    std::map<storm::RationalFunctionVariable, std::vector<storm::RationalFunctionCoefficient>> createCartesianProduct(std::set<storm::RationalFunctionVariable> const& parameters, std::vector<double> const& values) {
+        std::map<storm::RationalFunctionVariable, std::vector<storm::RationalFunctionCoefficient>> result;
+        for (auto const& parameter : parameters) {
+            for (auto const& value : values) {
+                result[parameter].push_back(storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value));
+            }
+        }
+        return result;
+    }
+
+    template<typename ModelCheckerType, typename ModelType>
+    void checkBatchAgainstSingleInstances(ModelType const& model, std::shared_ptr<storm::logic::Formula const> const& formula, bool graphPreserving, std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> const& valuations) {
+        storm::Environment env;
+        uint64_t initialState = *model.getInitialStates().begin();
+
+        ModelCheckerType batchChecker(model);
+        batchChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formula, true));
+        batchChecker.setInstantiationsAreGraphPreserving(graphPreserving);
+
+        uint64_t numberOfInstances = 0;
+        batchChecker.checkBatch(env, valuations, [&] (std::unique_ptr<storm::modelchecker::CheckResult>&& result, uint64_t index) {
+            EXPECT_EQ(numberOfInstances, index);
+            ++numberOfInstances;
+
+            // Check the instance without any hints obtained from previous instances.
+            ModelCheckerType singleChecker(model);
+            singleChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formula, true));
+            std::unique_ptr<storm::modelchecker::CheckResult> expectedResult = singleChecker.check(env, valuations[index]);
+
+            ASSERT_TRUE(result);
+            EXPECT_NEAR(expectedResult->asExplicitQuantitativeCheckResult<double>()[initialState], result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        });
+        EXPECT_EQ(valuations.size(), numberOfInstances);
+    }
+
+    TEST(SparseInstantiationModelCheckerTest, Brp_Prob_Batch) {
+        carl::VariablePool::getInstance().clear();
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P=? [F s=5 ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+        auto valuations = storm::utility::parametric::getValuationsOfCartesianProduct<storm::RationalFunction>(createCartesianProduct(storm::models::sparse::getProbabilityParameters(*model), {0.6, 0.7, 0.8, 0.9}));
+        EXPECT_EQ(16ull, valuations.size());
+
+        checkBatchAgainstSingleInstances<storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>>(*model, formulas[0], false, valuations);
+        checkBatchAgainstSingleInstances<storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>>(*model, formulas[0], true, valuations);
+
+        carl::VariablePool::getInstance().clear();
+    }
+
+    TEST(SparseInstantiationModelCheckerTest, TwoDice_Prob_Batch) {
+        carl::VariablePool::getInstance().clear();
+
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pmdp/two_dice.nm";
+        std::string formulaAsString = "Pmin=? [ F \"doubles\" ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Mdp<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalFunction>>();
+
+        auto valuations = storm::utility::parametric::getValuationsOfCartesianProduct<storm::RationalFunction>(createCartesianProduct(storm::models::sparse::getProbabilityParameters(*model), {0.3, 0.4, 0.5, 0.6, 0.7}));
+        EXPECT_EQ(25ull, valuations.size());
+
+        checkBatchAgainstSingleInstances<storm::modelchecker::SparseMdpInstantiationModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double>>(*model, formulas[0], false, valuations);
+        checkBatchAgainstSingleInstances<storm::modelchecker::SparseMdpInstantiationModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double>>(*model, formulas[0], true, valuations);
+
+        carl::VariablePool::getInstance().clear();
+    }
+}
+
+#endif
@@ -12,6 +12,9 @@
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/storage/jani/Property.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm-pars/settings/modules/RegionSettings.h"
 
 
 namespace {
@@ -341,6 +344,49 @@ namespace {
         EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true));
         
     }
+    
+    TYPED_TEST(SparseMdpParameterLiftingTest, Brp_Rew_Monotonicity) {
+        typedef typename TestFixture::ValueType ValueType;
+        
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pmdp/brp16_2.nm";
+        std::string formulaAsString = "R>2.5 [F ((s=5) | (s=0&srep=3)) ]";
+        std::string constantsAsString = ""; //!! this model will have 4 parameters
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        program = storm::utility::prism::preprocess(program, constantsAsString);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Mdp<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalFunction>>();
+        
+        auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        auto rewParameters = storm::models::sparse::getRewardParameters(*model);
+        modelParameters.insert(rewParameters.begin(), rewParameters.end());
+        
+        auto task = storm::api::createTask<storm::RationalFunction>(formulas[0], true);
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        auto monotoneRegionChecker = [&] () {
+            std::unique_ptr<storm::settings::SettingMemento> useMonotonicity = storm::settings::mutableModule<storm::settings::modules::RegionSettings>().overrideUseMonotonicitySet(true);
+            return storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, ValueType>(this->env(), model, task);
+        }();
+        
+        //start testing
+        auto allSatRegion=storm::api::parseRegion<storm::RationalFunction>("0.7<=pK<=0.9,0.6<=pL<=0.85,0.9<=TOMsg<=0.95,0.85<=TOAck<=0.9", modelParameters);
+        auto exBothRegion=storm::api::parseRegion<storm::RationalFunction>("0.1<=pK<=0.7,0.2<=pL<=0.8,0.15<=TOMsg<=0.65,0.3<=TOAck<=0.9", modelParameters);
+        auto allVioRegion=storm::api::parseRegion<storm::RationalFunction>("0.1<=pK<=0.4,0.2<=pL<=0.3,0.15<=TOMsg<=0.3,0.1<=TOAck<=0.2", modelParameters);
+        
+        for (auto const& region : {allSatRegion, exBothRegion, allVioRegion}) {
+            EXPECT_EQ(regionChecker->analyzeRegion(this->env(), region, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true), monotoneRegionChecker->analyzeRegion(this->env(), region, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true)) << "for region " << region;
+        }
+        
+        // The rewards are monotonically increasing in TOMsg and TOAck. Not lifting these parameters yields bounds that are at least as tight.
+        for (auto const& region : {allSatRegion, exBothRegion, allVioRegion}) {
+            double lowerBound = storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), region, storm::OptimizationDirection::Minimize));
+            double upperBound = storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), region, storm::OptimizationDirection::Maximize));
+            double monotoneLowerBound = storm::utility::convertNumber<double>(monotoneRegionChecker->getBoundAtInitState(this->env(), region, storm::OptimizationDirection::Minimize));
+            double monotoneUpperBound = storm::utility::convertNumber<double>(monotoneRegionChecker->getBoundAtInitState(this->env(), region, storm::OptimizationDirection::Maximize));
+            EXPECT_LE(lowerBound, monotoneLowerBound + 1e-6) << "for region " << region;
+            EXPECT_LE(monotoneLowerBound, monotoneUpperBound + 1e-6) << "for region " << region;
+            EXPECT_LE(monotoneUpperBound, upperBound + 1e-6) << "for region " << region;
+        }
+    }
 
 
 }
@@ -0,0 +1,57 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+#include "storm/utility/constants.h"
+
+TEST(CompiledRationalFunctionsTest, Evaluate) {
+    carl::VariablePool::getInstance().clear();
+
+    auto cache = std::make_shared<storm::RawPolynomialCache>();
+    storm::RationalFunctionVariable xVariable = carl::freshRealVariable("x");
+    storm::RationalFunctionVariable yVariable = carl::freshRealVariable("y");
+    storm::RationalFunction x(storm::Polynomial(storm::RawPolynomial(xVariable), cache));
+    storm::RationalFunction y(storm::Polynomial(storm::RawPolynomial(yVariable), cache));
+    auto constant = [] (std::string const& value) { return storm::utility::convertNumber<storm::RationalFunction>(value); };
+
+    std::vector<storm::RationalFunction> functions;
+    functions.push_back((x * x * y + constant("3") * x * y + constant("2")) / (y + constant("1")));
+    functions.push_back(x * x * x - constant("2") * x + y * y);
+    functions.push_back(constant("5/2"));
+    functions.push_back(x * y * (constant("1") - x) * (constant("1") - y));
+    // A polynomial that also occurs in a previous function.
+    functions.push_back(constant("1") / (y + constant("1")));
+
+    storm::utility::parametric::CompiledRationalFunctions compiledFunctions(functions);
+    ASSERT_EQ(functions.size(), compiledFunctions.getNumberOfFunctions());
+    EXPECT_EQ(2ull, compiledFunctions.getVariables().size());
+
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+    for (std::string const& xValue : {"0", "1/3", "9/10", "-2"}) {
+        for (std::string const& yValue : {"0", "1/2", "7/4"}) {
+            storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+            valuation.emplace(xVariable, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(xValue));
+            valuation.emplace(yVariable, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(yValue));
+            valuations.push_back(std::move(valuation));
+        }
+    }
+
+    std::vector<double> result;
+    compiledFunctions.evaluate(valuations, result);
+    ASSERT_EQ(functions.size() * valuations.size(), result.size());
+    for (uint64_t functionIndex = 0; functionIndex < functions.size(); ++functionIndex) {
+        for (uint64_t valuationIndex = 0; valuationIndex < valuations.size(); ++valuationIndex) {
+            double expected = storm::utility::convertNumber<double>(storm::utility::parametric::evaluate(functions[functionIndex], valuations[valuationIndex]));
+            EXPECT_NEAR(expected, result[functionIndex * valuations.size() + valuationIndex], 1e-12) << "for function " << functions[functionIndex] << " and valuation " << valuationIndex;
+        }
+    }
+
+    carl::VariablePool::getInstance().clear();
+}
+
+#endif
@@ -257,4 +257,52 @@ TEST(ModelInstantiatorTest, Consensus) {
     EXPECT_NEAR(0.3526577219, quantitativeChkResult[*instantiated.getInitialStates().begin()], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(ModelInstantiatorTest, BrpProbBatch) {
+    carl::VariablePool::getInstance().clear();
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+    
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size()==1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc);
+    
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    
+    // More valuations than fit into a single block.
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations;
+    for (uint64_t index = 0; index < 100; ++index) {
+        std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+        valuation.insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.5 + 0.004 * index)));
+        valuation.insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.9 - 0.003 * index)));
+        valuations.push_back(std::move(valuation));
+    }
+    
+    uint64_t numberOfInstances = 0;
+    modelInstantiator.instantiateBatch(valuations, [&] (storm::models::sparse::Dtmc<double> const& instantiated, uint64_t index) {
+        EXPECT_EQ(numberOfInstances, index);
+        ++numberOfInstances;
+        for (std::size_t row = 0; row < dtmc->getTransitionMatrix().getRowCount(); ++row) {
+            auto instantiatedEntry = instantiated.getTransitionMatrix().getRow(row).begin();
+            for (auto const& paramEntry : dtmc->getTransitionMatrix().getRow(row)) {
+                EXPECT_EQ(paramEntry.getColumn(), instantiatedEntry->getColumn());
+                double evaluatedValue = carl::toDouble(paramEntry.getValue().evaluate(valuations[index]));
+                EXPECT_NEAR(evaluatedValue, instantiatedEntry->getValue(), 1e-12);
+                ++instantiatedEntry;
+            }
+        }
+    });
+    EXPECT_EQ(valuations.size(), numberOfInstances);
+}
+
 #endif
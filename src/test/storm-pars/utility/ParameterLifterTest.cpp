@@ -0,0 +1,126 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include <algorithm>
+
+#include "storm-pars/transformer/ParameterLifter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/constants.h"
+
+namespace {
+
+    storm::storage::ParameterRegion<storm::RationalFunction> createRegion(storm::RationalFunctionVariable const& p, std::string const& lowerBound, std::string const& upperBound) {
+        storm::utility::parametric::Valuation<storm::RationalFunction> lowerBoundaries, upperBoundaries;
+        lowerBoundaries.emplace(p, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(lowerBound));
+        upperBoundaries.emplace(p, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(upperBound));
+        return storm::storage::ParameterRegion<storm::RationalFunction>(std::move(lowerBoundaries), std::move(upperBoundaries));
+    }
+
+    storm::storage::ParameterRegion<storm::RationalFunction> createRegion(storm::RationalFunctionVariable const& p, std::string const& pLowerBound, std::string const& pUpperBound, storm::RationalFunctionVariable const& q, std::string const& qLowerBound, std::string const& qUpperBound) {
+        storm::utility::parametric::Valuation<storm::RationalFunction> lowerBoundaries, upperBoundaries;
+        lowerBoundaries.emplace(p, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(pLowerBound));
+        upperBoundaries.emplace(p, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(pUpperBound));
+        lowerBoundaries.emplace(q, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(qLowerBound));
+        upperBoundaries.emplace(q, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(qUpperBound));
+        return storm::storage::ParameterRegion<storm::RationalFunction>(std::move(lowerBoundaries), std::move(upperBoundaries));
+    }
+
+    std::vector<double> getSortedRowValues(storm::storage::SparseMatrix<double> const& matrix) {
+        std::vector<double> values;
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            values.push_back(matrix.getRow(row).begin()->getValue());
+        }
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+
+}
+
+TEST(ParameterLifterTest, MonotoneParameterWithNegativeValues) {
+    carl::VariablePool::getInstance().clear();
+
+    // The single entry p*p is increasing for nonnegative values of p, but not on the whole real line.
+    storm::RationalFunctionVariable p = carl::freshRealVariable("p");
+    storm::RationalFunction pFunction(storm::Polynomial(storm::RawPolynomial(p), std::make_shared<storm::RawPolynomialCache>()));
+    storm::storage::SparseMatrixBuilder<storm::RationalFunction> builder(1, 1, 1);
+    builder.addNextValue(0, 0, pFunction * pFunction);
+    storm::storage::SparseMatrix<storm::RationalFunction> pMatrix = builder.build();
+    std::vector<storm::RationalFunction> pVector(1, storm::utility::zero<storm::RationalFunction>());
+    storm::storage::BitVector selected(1, true);
+
+    storm::transformer::ParameterLifter<storm::RationalFunction, double> lifter(pMatrix, pVector, selected, selected, false, true);
+    EXPECT_EQ(1ull, lifter.getIncreasingParameters().size());
+    EXPECT_TRUE(lifter.getDecreasingParameters().empty());
+
+    // The monotone parameter is set to the optimal bound instead of being lifted.
+    lifter.specifyRegion(createRegion(p, "1/4", "1/2"), storm::OptimizationDirection::Maximize);
+    ASSERT_EQ(1ull, lifter.getMatrix().getRowCount());
+    EXPECT_EQ(0.25, lifter.getMatrix().getRow(0).begin()->getValue());
+    lifter.specifyRegion(createRegion(p, "1/4", "1/2"), storm::OptimizationDirection::Minimize);
+    ASSERT_EQ(1ull, lifter.getMatrix().getRowCount());
+    EXPECT_EQ(0.0625, lifter.getMatrix().getRow(0).begin()->getValue());
+
+    // For negative values, the parameter has to be lifted.
+    lifter.specifyRegion(createRegion(p, "-1", "1/2"), storm::OptimizationDirection::Maximize);
+    EXPECT_TRUE(lifter.getIncreasingParameters().empty());
+    ASSERT_EQ(1ull, lifter.getMatrix().getRowGroupCount());
+    ASSERT_EQ(2ull, lifter.getMatrix().getRowCount());
+    EXPECT_EQ(1.0, lifter.getMatrix().getRow(0).begin()->getValue());
+    EXPECT_EQ(0.25, lifter.getMatrix().getRow(1).begin()->getValue());
+
+    // The parameter remains lifted for subsequent regions.
+    lifter.specifyRegion(createRegion(p, "1/4", "1/2"), storm::OptimizationDirection::Maximize);
+    ASSERT_EQ(2ull, lifter.getMatrix().getRowCount());
+    EXPECT_EQ(0.0625, lifter.getMatrix().getRow(0).begin()->getValue());
+    EXPECT_EQ(0.25, lifter.getMatrix().getRow(1).begin()->getValue());
+
+    carl::VariablePool::getInstance().clear();
+}
+
+TEST(ParameterLifterTest, MonotoneParameterWithOtherNegativeParameter) {
+    carl::VariablePool::getInstance().clear();
+
+    // The single entry p*q is increasing in p and q if both are nonnegative. For negative values of q, it is decreasing in p.
+    storm::RationalFunctionVariable p = carl::freshRealVariable("p");
+    storm::RationalFunctionVariable q = carl::freshRealVariable("q");
+    auto cache = std::make_shared<storm::RawPolynomialCache>();
+    storm::RationalFunction pFunction(storm::Polynomial(storm::RawPolynomial(p), cache));
+    storm::RationalFunction qFunction(storm::Polynomial(storm::RawPolynomial(q), cache));
+    storm::storage::SparseMatrixBuilder<storm::RationalFunction> builder(1, 1, 1);
+    builder.addNextValue(0, 0, pFunction * qFunction);
+    storm::storage::SparseMatrix<storm::RationalFunction> pMatrix = builder.build();
+    std::vector<storm::RationalFunction> pVector(1, storm::utility::zero<storm::RationalFunction>());
+    storm::storage::BitVector selected(1, true);
+
+    storm::transformer::ParameterLifter<storm::RationalFunction, double> lifter(pMatrix, pVector, selected, selected, false, true);
+    EXPECT_EQ(2ull, lifter.getIncreasingParameters().size());
+    EXPECT_TRUE(lifter.getDecreasingParameters().empty());
+
+    // For nonnegative regions, both parameters are set to the optimal bound.
+    lifter.specifyRegion(createRegion(p, "1/4", "1/2", q, "1/2", "1"), storm::OptimizationDirection::Maximize);
+    ASSERT_EQ(1ull, lifter.getMatrix().getRowCount());
+    EXPECT_EQ(0.5, lifter.getMatrix().getRow(0).begin()->getValue());
+
+    // Only q may become negative, but this also invalidates the monotonicity in p. Hence, both parameters are lifted.
+    lifter.specifyRegion(createRegion(p, "1/4", "1/2", q, "-1", "-1/2"), storm::OptimizationDirection::Maximize);
+    EXPECT_TRUE(lifter.getIncreasingParameters().empty());
+    EXPECT_TRUE(lifter.getDecreasingParameters().empty());
+    ASSERT_EQ(1ull, lifter.getMatrix().getRowGroupCount());
+    ASSERT_EQ(4ull, lifter.getMatrix().getRowCount());
+    EXPECT_EQ(std::vector<double>({-0.5, -0.25, -0.25, -0.125}), getSortedRowValues(lifter.getMatrix()));
+
+    // The parameters remain lifted for subsequent regions.
+    lifter.specifyRegion(createRegion(p, "1/4", "1/2", q, "1/2", "1"), storm::OptimizationDirection::Maximize);
+    ASSERT_EQ(4ull, lifter.getMatrix().getRowCount());
+    EXPECT_EQ(std::vector<double>({0.125, 0.25, 0.25, 0.5}), getSortedRowValues(lifter.getMatrix()));
+
+    carl::VariablePool::getInstance().clear();
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include <set>
+
+#include "storm-pars/utility/parametric.h"
+#include "storm/utility/constants.h"
+
+TEST(ParametricTest, ValuationsOfCartesianProduct) {
+    carl::VariablePool::getInstance().clear();
+
+    storm::RationalFunctionVariable p = carl::freshRealVariable("p");
+    storm::RationalFunctionVariable q = carl::freshRealVariable("q");
+    storm::RationalFunctionVariable r = carl::freshRealVariable("r");
+
+    std::map<storm::RationalFunctionVariable, std::vector<storm::RationalFunctionCoefficient>> cartesianProduct;
+    std::map<storm::RationalFunctionVariable, uint64_t> numberOfValues = {{p, 3}, {q, 2}, {r, 2}};
+    for (auto const& entry : numberOfValues) {
+        for (uint64_t value = 0; value < entry.second; ++value) {
+            cartesianProduct[entry.first].push_back(storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value));
+        }
+    }
+
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations = storm::utility::parametric::getValuationsOfCartesianProduct<storm::RationalFunction>(cartesianProduct);
+
+    // The first parameter moves fastest and every parameter reverses its direction once it reached the end of its values.
+    std::vector<std::vector<uint64_t>> expectedOrder = {{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {2, 1, 0}, {1, 1, 0}, {0, 1, 0},
+                                                        {0, 1, 1}, {1, 1, 1}, {2, 1, 1}, {2, 0, 1}, {1, 0, 1}, {0, 0, 1}};
+    ASSERT_EQ(expectedOrder.size(), valuations.size());
+    std::set<std::vector<uint64_t>> encounteredValuations;
+    for (uint64_t index = 0; index < valuations.size(); ++index) {
+        std::vector<uint64_t> valuation = {storm::utility::convertNumber<uint64_t>(valuations[index].at(p)), storm::utility::convertNumber<uint64_t>(valuations[index].at(q)), storm::utility::convertNumber<uint64_t>(valuations[index].at(r))};
+        EXPECT_EQ(expectedOrder[index], valuation);
+        encounteredValuations.insert(valuation);
+
+        // Consecutive valuations only differ in the value of a single parameter which moves to a neighboring value.
+        if (index > 0) {
+            uint64_t distance = 0;
+            for (auto const& parameter : {p, q, r}) {
+                distance += storm::utility::convertNumber<uint64_t>(storm::utility::abs<storm::RationalFunctionCoefficient>(valuations[index].at(parameter) - valuations[index - 1].at(parameter)));
+            }
+            EXPECT_EQ(1ull, distance);
+        }
+    }
+    EXPECT_EQ(valuations.size(), encounteredValuations.size());
+
+    // A single value for each parameter yields a single valuation.
+    std::map<storm::RationalFunctionVariable, std::vector<storm::RationalFunctionCoefficient>> singlePoint = {{p, {storm::utility::one<storm::RationalFunctionCoefficient>()}}, {q, {storm::utility::zero<storm::RationalFunctionCoefficient>()}}};
+    EXPECT_EQ(1ull, storm::utility::parametric::getValuationsOfCartesianProduct<storm::RationalFunction>(singlePoint).size());
+
+    carl::VariablePool::getInstance().clear();
+}
+
+#endif
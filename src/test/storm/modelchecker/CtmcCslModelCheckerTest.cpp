@@ -17,11 +17,15 @@
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
@@ -388,4 +392,65 @@ namespace {
         }
         
     }
-}
\ No newline at end of file
+    
+    TEST(SparseCtmcCslModelCheckerTest, MultipleTimeBounds) {
+        std::string formulasString = "P=? [ F<=10 \"first_queue_full\" ]";
+        formulasString += "; P=? [ F<=2 \"first_queue_full\" ]";
+        formulasString += "; P=? [ F<=0.5 \"first_queue_full\" ]";
+        formulasString += "; P=? [ F<=0 \"first_queue_full\" ]";
+        
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm", true);
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+        storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*model);
+        storm::Environment env;
+        
+        // Checking the first formula for all time bounds at once has to coincide with checking each formula separately.
+        std::vector<double> timeBounds = {10, 2, 0.5, 0};
+        auto results = checker.computeBoundedUntilProbabilities(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]), timeBounds);
+        ASSERT_EQ(timeBounds.size(), results.size());
+        for (uint64_t index = 0; index < timeBounds.size(); ++index) {
+            auto expected = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[index]));
+            auto const& expectedValues = expected->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            auto const& values = results[index]->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            ASSERT_EQ(expectedValues.size(), values.size());
+            for (uint64_t state = 0; state < values.size(); ++state) {
+                EXPECT_NEAR(expectedValues[state], values[state], 1e-8);
+            }
+        }
+    }
+    
+    TEST(SparseCtmcCslModelCheckerTest, SteadyStateDetection) {
+        // For large time bounds, the transient analysis reaches the steady state long before the right truncation point.
+        std::string formulasString = "P=? [ F<=1000 \"network_full\" ]";
+        formulasString += "; R=? [I=1000]";
+        
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm", true);
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+        storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(*model);
+        storm::Environment env;
+        std::vector<double> timeBounds = {10, 1000};
+        
+        std::vector<std::vector<double>> valuesWithDetection;
+        std::vector<std::vector<double>> valuesWithoutDetection;
+        for (bool detectSteadyState : {true, false}) {
+            auto steadyStateDetection = storm::settings::mutableModule<storm::settings::modules::ModelCheckerSettings>().overrideSteadyStateDetectionSet(detectSteadyState);
+            auto& values = detectSteadyState ? valuesWithDetection : valuesWithoutDetection;
+            for (auto const& formula : formulas) {
+                values.push_back(checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula))->asExplicitQuantitativeCheckResult<double>().getValueVector());
+            }
+            for (auto& result : checker.computeBoundedUntilProbabilities(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]), timeBounds)) {
+                values.push_back(result->asExplicitQuantitativeCheckResult<double>().getValueVector());
+            }
+        }
+        
+        ASSERT_EQ(valuesWithoutDetection.size(), valuesWithDetection.size());
+        for (uint64_t index = 0; index < valuesWithDetection.size(); ++index) {
+            ASSERT_EQ(valuesWithoutDetection[index].size(), valuesWithDetection[index].size());
+            for (uint64_t state = 0; state < valuesWithDetection[index].size(); ++state) {
+                EXPECT_NEAR(valuesWithoutDetection[index][state], valuesWithDetection[index][state], 1e-6 * std::max(1.0, valuesWithoutDetection[index][state]));
+            }
+        }
+    }
+}
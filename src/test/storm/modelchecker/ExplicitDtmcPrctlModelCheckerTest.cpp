@@ -59,6 +59,14 @@ TEST(ExplicitDtmcPrctlModelCheckerTest, Die) {
     
     EXPECT_NEAR(1.0 / 6.0, quantitativeResult3[0], precision);
     
+    // The values become stationary long before the step bound is reached.
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F<=100000 \"three\"]");
+    
+    result = checker.check(env, *formula);
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double>& quantitativeResultBounded = result->asExplicitQuantitativeCheckResult<double>();
+    
+    EXPECT_NEAR(1.0 / 6.0, quantitativeResultBounded[0], precision);
+    
     formula = formulaParser.parseSingleFormulaFromString("R=? [F \"done\"]");
     
     result = checker.check(env, *formula);
@@ -10,6 +10,9 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/MinMaxEquationSolverSettings.h"
+#include "storm/settings/SettingMemento.h"
 
 #include "storm/settings/modules/NativeEquationSolverSettings.h"
 #include "storm-parsers/parser/AutoParser.h"
@@ -342,3 +345,73 @@ TEST(LraMdpPrctlModelCheckerTest, LRA) {
         EXPECT_NEAR(0.3 / 3., quantitativeResult2[14], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
     }
 }
+
+TEST(LraMdpPrctlModelCheckerTest, LRA_MultipleMecs) {
+    // Three MECs: a periodic one {0,1} in which a scheduler can stay in state 0, a Markov chain {2,3,4} and {5,6}
+    // in which a scheduler can stay in state 5. State 7 chooses between the first MEC and the other two.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(11, 8, 15, true, true, 8);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 1, 1);
+    matrixBuilder.addNextValue(1, 0, 1);
+    matrixBuilder.newRowGroup(2);
+    matrixBuilder.addNextValue(2, 0, 1);
+    matrixBuilder.newRowGroup(3);
+    matrixBuilder.addNextValue(3, 3, 0.5);
+    matrixBuilder.addNextValue(3, 4, 0.5);
+    matrixBuilder.newRowGroup(4);
+    matrixBuilder.addNextValue(4, 2, 1);
+    matrixBuilder.newRowGroup(5);
+    matrixBuilder.addNextValue(5, 2, 0.4);
+    matrixBuilder.addNextValue(5, 4, 0.6);
+    matrixBuilder.newRowGroup(6);
+    matrixBuilder.addNextValue(6, 5, 1);
+    matrixBuilder.addNextValue(7, 6, 1);
+    matrixBuilder.newRowGroup(8);
+    matrixBuilder.addNextValue(8, 5, 0.5);
+    matrixBuilder.addNextValue(8, 6, 0.5);
+    matrixBuilder.newRowGroup(9);
+    matrixBuilder.addNextValue(9, 0, 1);
+    matrixBuilder.addNextValue(10, 2, 0.5);
+    matrixBuilder.addNextValue(10, 5, 0.5);
+    storm::storage::SparseMatrix<double> transitionMatrix = matrixBuilder.build();
+
+    storm::models::sparse::StateLabeling ap(8);
+    ap.addLabel("a");
+    ap.addLabelToState("a", 1);
+    ap.addLabelToState("a", 3);
+    ap.addLabelToState("a", 4);
+    ap.addLabelToState("a", 6);
+
+    storm::models::sparse::Mdp<double> mdp(transitionMatrix, ap);
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> maxFormula = formulaParser.parseSingleFormulaFromString("LRAmax=? [\"a\"]");
+    std::shared_ptr<storm::logic::Formula const> minFormula = formulaParser.parseSingleFormulaFromString("LRAmin=? [\"a\"]");
+
+    std::vector<double> expectedMax = {1. / 2., 1. / 2., 7. / 11., 7. / 11., 7. / 11., 2. / 3., 2. / 3., 43. / 66.};
+    std::vector<double> expectedMin = {0.0, 0.0, 7. / 11., 7. / 11., 7. / 11., 0.0, 0.0, 0.0};
+
+    std::vector<storm::solver::LraMethod> methods = {storm::solver::LraMethod::ValueIteration};
+#ifdef STORM_HAVE_GLPK
+    methods.push_back(storm::solver::LraMethod::LinearProgramming);
+#endif
+    for (auto const& method : methods) {
+        auto lraMethod = storm::settings::mutableModule<storm::settings::modules::MinMaxEquationSolverSettings>().overrideLraMethod(method);
+        // With Intel TBB, value iteration analyzes the MECs concurrently.
+        for (bool useIntelTbb : {false, true}) {
+            auto intelTbb = storm::settings::mutableModule<storm::settings::modules::CoreSettings>().overrideUseIntelTbbSet(useIntelTbb);
+            storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(mdp);
+
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*maxFormula);
+            storm::modelchecker::ExplicitQuantitativeCheckResult<double>& maxResult = result->asExplicitQuantitativeCheckResult<double>();
+            for (uint64_t state = 0; state < expectedMax.size(); ++state) {
+                EXPECT_NEAR(expectedMax[state], maxResult[state], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+            }
+
+            result = checker.check(*minFormula);
+            storm::modelchecker::ExplicitQuantitativeCheckResult<double>& minResult = result->asExplicitQuantitativeCheckResult<double>();
+            for (uint64_t state = 0; state < expectedMin.size(); ++state) {
+                EXPECT_NEAR(expectedMin[state], minResult[state], storm::settings::getModule<storm::settings::modules::NativeEquationSolverSettings>().getPrecision());
+            }
+        }
+    }
+}
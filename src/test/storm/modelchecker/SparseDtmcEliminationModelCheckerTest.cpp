@@ -9,6 +9,7 @@
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm-parsers/parser/AutoParser.h"
 
@@ -107,6 +108,31 @@ TEST(SparseDtmcEliminationModelCheckerTest, Crowds) {
     EXPECT_NEAR(0.96592521978041668, quantitativeResult5[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(SparseDtmcEliminationModelCheckerTest, Crowds_Threads) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>> checker(*dtmc);
+
+    // Small SCCs force the hybrid elimination to descend into several independent sub-SCCs.
+    storm::settings::modules::EliminationSettings& eliminationSettings = storm::settings::mutableModule<storm::settings::modules::EliminationSettings>();
+    std::unique_ptr<storm::settings::SettingMemento> hybridElimination = eliminationSettings.overrideEliminationMethod(storm::settings::modules::EliminationSettings::EliminationMethod::Hybrid);
+    std::unique_ptr<storm::settings::SettingMemento> maximalSccSize = eliminationSettings.overrideMaximalSccSize(2);
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+    for (uint64_t numberOfThreads : {1, 2, 4}) {
+        std::unique_ptr<storm::settings::SettingMemento> threads = eliminationSettings.overrideNumberOfThreads(numberOfThreads);
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*formula);
+        EXPECT_NEAR(0.3328800375801578281, result->asExplicitQuantitativeCheckResult<double>()[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()) << "for " << numberOfThreads << " threads";
+    }
+}
+
 TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/leader4_8.tra", STORM_TEST_RESOURCES_DIR "/lab/leader4_8.lab", "", STORM_TEST_RESOURCES_DIR "/rew/leader4_8.pick.trans.rew");
 
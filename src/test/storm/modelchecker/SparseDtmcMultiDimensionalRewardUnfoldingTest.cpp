@@ -6,6 +6,9 @@
 #include "storm/storage/jani/Property.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/api/storm.h"
 #include "storm-parsers/api/storm-parsers.h"
@@ -99,3 +102,51 @@ TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds) {
     ASSERT_TRUE(result->isExplicitQuantitativeCheckResult());
     EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("620529/1364000")), result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
+
+TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds_spilling) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/crowds_cost_bounded.pm";
+    std::string formulasAsString = "P=? [F{\"num_runs\"}<=3,{\"observe0\"}>1 true]";
+    formulasAsString += "; R{\"observe0\"}=? [C{\"num_runs\"}<=3]";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "CrowdSize=4");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Dtmc<double>>();
+    uint_fast64_t const initState = *dtmc->getInitialStates().begin();
+    
+    for (auto const& formula : formulas) {
+        std::unique_ptr<storm::modelchecker::CheckResult> inMemoryResult = storm::api::verifyWithSparseEngine(dtmc, storm::api::createTask<double>(formula, true));
+        ASSERT_TRUE(inMemoryResult->isExplicitQuantitativeCheckResult());
+        
+        // With a memory limit of zero, every stored epoch solution is spilled to disk (and read back when needed).
+        std::unique_ptr<storm::settings::SettingMemento> memoryLimit = storm::settings::mutableModule<storm::settings::modules::ModelCheckerSettings>().overrideEpochSolutionMemoryLimit(0);
+        std::unique_ptr<storm::modelchecker::CheckResult> spillingResult = storm::api::verifyWithSparseEngine(dtmc, storm::api::createTask<double>(formula, true));
+        ASSERT_TRUE(spillingResult->isExplicitQuantitativeCheckResult());
+        EXPECT_EQ(inMemoryResult->asExplicitQuantitativeCheckResult<double>()[initState], spillingResult->asExplicitQuantitativeCheckResult<double>()[initState]);
+    }
+}
+
+TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds_parallel) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/crowds_cost_bounded.pm";
+    std::string formulasAsString = "P=? [F{\"num_runs\"}<=3,{\"observe0\"}>1 true]";
+    formulasAsString += "; P=? [F{\"num_runs\"}<=3,{\"observe1\"}>1 true]";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "CrowdSize=4");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalNumber>> dtmc = storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalNumber>>();
+    uint_fast64_t const initState = *dtmc->getInitialStates().begin();
+    
+    for (auto const& formula : formulas) {
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = storm::api::verifyWithSparseEngine(dtmc, storm::api::createTask<storm::RationalNumber>(formula, true));
+        ASSERT_TRUE(sequentialResult->isExplicitQuantitativeCheckResult());
+        
+        // If TBB is available, independent epochs are now analyzed concurrently.
+        std::unique_ptr<storm::settings::SettingMemento> useIntelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        std::unique_ptr<storm::modelchecker::CheckResult> parallelResult = storm::api::verifyWithSparseEngine(dtmc, storm::api::createTask<storm::RationalNumber>(formula, true));
+        ASSERT_TRUE(parallelResult->isExplicitQuantitativeCheckResult());
+        EXPECT_EQ(sequentialResult->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState], parallelResult->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+    }
+}
@@ -8,7 +8,9 @@
 #include "storm-parsers/parser/FormulaParser.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/modules/ExplorationSettings.h"
+#include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -86,3 +88,92 @@ TEST(SparseExplorationModelCheckerTest, AsynchronousLeader) {
     
     EXPECT_NEAR(1, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
 }
+
+TEST(SparseExplorationModelCheckerTest, Crowds_MemoryCap) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    
+    // The explored part of the model needs several hundred kilobytes, so states have to be evicted.
+    std::unique_ptr<storm::settings::SettingMemento> memoryCap = storm::settings::mutableModule<storm::settings::modules::ExplorationSettings>().overrideMemoryCap(0.1);
+    
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Dtmc<double>, uint32_t> checker(program);
+    double precision = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision();
+    
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+    
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+    
+    // The result is the lower bound, which must not exceed the exact value by more than its rounding error.
+    EXPECT_LE(quantitativeResult1[0], 0.3328800375801578281 + 1e-9);
+    EXPECT_NEAR(0.3328800375801578281, quantitativeResult1[0], precision);
+    
+    formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observeIGreater1\"]");
+    
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<double>();
+    
+    EXPECT_LE(quantitativeResult2[0], 0.1522194965 + 1e-9);
+    EXPECT_NEAR(0.1522194965, quantitativeResult2[0], precision);
+}
+
+TEST(SparseExplorationModelCheckerTest, Dice_Threads) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::string> formulas = {"Pmin=? [F \"two\"]", "Pmax=? [F \"three\"]", "Pmin=? [F \"four\"]"};
+    double precision = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision();
+    
+    auto checkAll = [&] () {
+        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t> checker(program);
+        std::vector<double> results;
+        for (auto const& formula : formulas) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formulaParser.parseSingleFormulaFromString(formula), true));
+            results.push_back(result->asExplicitQuantitativeCheckResult<double>()[0]);
+        }
+        return results;
+    };
+    
+    std::vector<double> sequentialResults = checkAll();
+    for (uint_fast64_t numberOfThreads : {2, 4}) {
+        std::unique_ptr<storm::settings::SettingMemento> threads = storm::settings::mutableModule<storm::settings::modules::ExplorationSettings>().overrideNumberOfThreads(numberOfThreads);
+        std::vector<double> concurrentResults = checkAll();
+        ASSERT_EQ(sequentialResults.size(), concurrentResults.size());
+        for (uint64_t index = 0; index < sequentialResults.size(); ++index) {
+            // Both results are lower bounds that are at most the precision below the exact value.
+            EXPECT_NEAR(sequentialResults[index], concurrentResults[index], precision) << "for formula " << formulas[index] << " and " << numberOfThreads << " threads";
+        }
+    }
+}
+
+TEST(SparseExplorationModelCheckerTest, Crowds_Threads) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::string> formulas = {"P=? [F \"observe0Greater1\"]", "P=? [F \"observeIGreater1\"]"};
+    double precision = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision();
+    
+    auto checkAll = [&] () {
+        storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Dtmc<double>, uint32_t> checker(program);
+        std::vector<double> results;
+        for (auto const& formula : formulas) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formulaParser.parseSingleFormulaFromString(formula), true));
+            results.push_back(result->asExplicitQuantitativeCheckResult<double>()[0]);
+        }
+        return results;
+    };
+    
+    std::vector<double> sequentialResults = checkAll();
+    for (uint_fast64_t numberOfThreads : {2, 4}) {
+        std::unique_ptr<storm::settings::SettingMemento> threads = storm::settings::mutableModule<storm::settings::modules::ExplorationSettings>().overrideNumberOfThreads(numberOfThreads);
+        std::vector<double> concurrentResults = checkAll();
+        ASSERT_EQ(sequentialResults.size(), concurrentResults.size());
+        for (uint64_t index = 0; index < sequentialResults.size(); ++index) {
+            EXPECT_NEAR(sequentialResults[index], concurrentResults[index], precision) << "for formula " << formulas[index] << " and " << numberOfThreads << " threads";
+        }
+    }
+}
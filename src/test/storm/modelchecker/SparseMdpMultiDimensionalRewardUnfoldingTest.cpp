@@ -8,6 +8,8 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/jani/Property.h"
 #include "storm/utility/constants.h"
 #include "storm/api/storm.h"
@@ -563,3 +565,28 @@ TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, lower_bounds) {
 
 
 #endif /* STORM_HAVE_HYPRO || defined STORM_HAVE_Z3_OPTIMIZE */
+
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_parallel) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/one_dim_walk.nm";
+    std::string constantsDef = "N=10";
+    std::string formulasAsString = "Pmax=? [ F{\"r\"}<=5,{\"l\"}<=4 x=N ] ";
+    formulasAsString += "; \n Pmin=? [ F{\"r\"}<=8,{\"l\"}<=6 x=N ] ";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsDef);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<storm::RationalNumber>> mdp = storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalNumber>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+    
+    for (auto const& formula : formulas) {
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = storm::api::verifyWithSparseEngine(mdp, storm::api::createTask<storm::RationalNumber>(formula, true));
+        ASSERT_TRUE(sequentialResult->isExplicitQuantitativeCheckResult());
+        
+        // If TBB is available, independent epochs are now analyzed concurrently.
+        std::unique_ptr<storm::settings::SettingMemento> useIntelTbb = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        std::unique_ptr<storm::modelchecker::CheckResult> parallelResult = storm::api::verifyWithSparseEngine(mdp, storm::api::createTask<storm::RationalNumber>(formula, true));
+        ASSERT_TRUE(parallelResult->isExplicitQuantitativeCheckResult());
+        EXPECT_EQ(sequentialResult->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState], parallelResult->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+    }
+}
@@ -4,6 +4,8 @@
 #if defined STORM_HAVE_HYPRO || defined STORM_HAVE_Z3_OPTIMIZE
 
 #include "storm/modelchecker/multiobjective/multiObjectiveModelChecking.h"
+#include "storm/modelchecker/multiobjective/SparseMultiObjectivePreprocessor.h"
+#include "storm/modelchecker/multiobjective/pcaa/PcaaWeightVectorChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/models/sparse/Mdp.h"
@@ -13,6 +15,7 @@
 #include "storm/api/storm.h"
 #include "storm-parsers/api/storm-parsers.h"
 #include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 
 TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, consensus) {
     storm::Environment env;
@@ -43,6 +46,30 @@ TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, consensus) {
     
 }
 
+TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, consensusBatched) {
+    storm::Environment env;
+    env.modelchecker().multi().setRefinementBatchSize(3);
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_consensus2_3_2.nm";
+    std::string formulasAsString = "multi(P>=0.1 [ F \"one_proc_err\" ], P>=0.8916673903 [ G \"one_coin_ok\" ])"; // achievability (true)
+    formulasAsString += "; \n multi(P>=0.11 [ F \"one_proc_err\" ], P>=0.8916673903 [ G \"one_coin_ok\" ])"; // achievability (false)
+    
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+    
+    std::unique_ptr<storm::modelchecker::CheckResult> result = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[0]->asMultiObjectiveFormula(), storm::modelchecker::multiobjective::MultiObjectiveMethodSelection::Pcaa);
+    ASSERT_TRUE(result->isExplicitQualitativeCheckResult());
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[initState]);
+    
+    result = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[1]->asMultiObjectiveFormula(), storm::modelchecker::multiobjective::MultiObjectiveMethodSelection::Pcaa);
+    ASSERT_TRUE(result->isExplicitQualitativeCheckResult());
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[initState]);
+}
+
 TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, zeroconf) {
     storm::Environment env;
     
@@ -96,6 +123,40 @@ TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, scheduler) {
     EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[initState]);
 }
 
+TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, schedulerWarmStart) {
+    storm::Environment env;
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_scheduler05.nm";
+    std::string formulasAsString = "multi(R{\"time\"}min=? [ F \"tasks_complete\" ], R{\"energy\"}min=? [  F \"tasks_complete\" ]) ";
+    
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    
+    typedef storm::modelchecker::multiobjective::WeightVectorCheckerFactory<storm::models::sparse::Mdp<double>> Factory;
+    auto preprocessorResult = storm::modelchecker::multiobjective::SparseMultiObjectivePreprocessor<storm::models::sparse::Mdp<double>>::preprocess(*mdp, formulas[0]->asMultiObjectiveFormula());
+    
+    // Consecutive checks with the same checker start from the scheduler of the previous check. The weighted result
+    // has to coincide with the one of a checker that starts from scratch. (The individual objective values may differ
+    // as there can be several optimal schedulers.)
+    auto weightedResult = [] (std::vector<double> const& weightVector, std::vector<double> const& values) {
+        double result = 0.0;
+        for (uint64_t objIndex = 0; objIndex < weightVector.size(); ++objIndex) {
+            result += weightVector[objIndex] * values[objIndex];
+        }
+        return result;
+    };
+    auto warmStartedChecker = Factory::create(preprocessorResult);
+    for (std::vector<double> const& weightVector : {std::vector<double>({0.5, 0.5}), std::vector<double>({0.7, 0.3}), std::vector<double>({0.2, 0.8}), std::vector<double>({0.5, 0.5})}) {
+        warmStartedChecker->check(env, weightVector);
+        auto freshChecker = Factory::create(preprocessorResult);
+        freshChecker->check(env, weightVector);
+        EXPECT_NEAR(weightedResult(weightVector, freshChecker->getUnderApproximationOfInitialStateResults()), weightedResult(weightVector, warmStartedChecker->getUnderApproximationOfInitialStateResults()), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+}
+
 TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, dpm) {
     storm::Environment env;
     
@@ -0,0 +1,76 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+
+#include "storm/solver/stateelimination/FillReducingOrdering.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/storage/BitVector.h"
+
+namespace {
+
+    // Builds a matrix with the given (directed) edges, each of which gets the same probability.
+    storm::storage::FlexibleSparseMatrix<double> buildMatrix(uint64_t numberOfStates, std::vector<std::pair<uint64_t, uint64_t>> edges) {
+        std::sort(edges.begin(), edges.end());
+        storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates, edges.size());
+        for (auto const& edge : edges) {
+            builder.addNextValue(edge.first, edge.second, 0.5);
+        }
+        return storm::storage::FlexibleSparseMatrix<double>(builder.build());
+    }
+
+    bool isPermutationOf(std::vector<uint64_t> order, storm::storage::BitVector const& states) {
+        std::sort(order.begin(), order.end());
+        return order == std::vector<uint64_t>(states.begin(), states.end());
+    }
+
+    TEST(FillReducingOrderingTest, MinimumDegreeStar) {
+        // A star whose center (state 0) has four leaves.
+        auto matrix = buildMatrix(5, {{0, 1}, {0, 2}, {0, 3}, {0, 4}, {3, 0}});
+        storm::storage::BitVector states(5, true);
+        storm::solver::stateelimination::FillReducingOrdering ordering(matrix, states);
+
+        // Eliminating the center first connects all leaves.
+        EXPECT_EQ(6ull, ordering.computeFillIn({0, 1, 2, 3, 4}));
+
+        // Minimum degree eliminates leaves until the center has degree one (and then prefers the lower index).
+        std::vector<uint64_t> order = ordering.computeMinimumDegreeOrder();
+        ASSERT_TRUE(isPermutationOf(order, states));
+        EXPECT_EQ(std::vector<uint64_t>({1, 2, 3, 0, 4}), order);
+        EXPECT_EQ(0ull, ordering.computeFillIn(order));
+    }
+
+    TEST(FillReducingOrderingTest, NestedDissectionPath) {
+        // A path 1 - 2 - ... - 7. State 0 is connected to all other states, but not to be ordered.
+        std::vector<std::pair<uint64_t, uint64_t>> edges;
+        for (uint64_t state = 1; state < 7; ++state) {
+            edges.emplace_back(state, state + 1);
+        }
+        for (uint64_t state = 1; state < 8; ++state) {
+            edges.emplace_back(0, state);
+            edges.emplace_back(state, 0);
+        }
+        auto matrix = buildMatrix(8, edges);
+        storm::storage::BitVector states(8, true);
+        states.set(0, false);
+        storm::solver::stateelimination::FillReducingOrdering ordering(matrix, states);
+
+        // The middle state separates the path and is eliminated last. The halves are split the same way.
+        std::vector<uint64_t> order = ordering.computeNestedDissectionOrder(1);
+        ASSERT_TRUE(isPermutationOf(order, states));
+        EXPECT_EQ(std::vector<uint64_t>({5, 7, 6, 1, 3, 2, 4}), order);
+        EXPECT_EQ(2ull, ordering.computeFillIn(order));
+
+        // Parts that are small enough are ordered by minimum degree, which does not cause fill-in on a path.
+        order = ordering.computeNestedDissectionOrder();
+        ASSERT_TRUE(isPermutationOf(order, states));
+        EXPECT_EQ(0ull, ordering.computeFillIn(order));
+
+        order = ordering.computeMinimumDegreeOrder();
+        ASSERT_TRUE(isPermutationOf(order, states));
+        EXPECT_EQ(0ull, ordering.computeFillIn(order));
+    }
+
+}
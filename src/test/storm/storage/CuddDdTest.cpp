@@ -612,6 +612,29 @@ TEST(CuddDd, MultiplyMatrixTest2) {
     ASSERT_EQ(3ull, r.getNonZeroCount());
 }
 
+TEST(CuddDd, StatisticsTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    manager->getStatistics().setEnabled(true);
+    
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd1 = manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd2 = manager->getRange(x.second).template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd3;
+    ASSERT_NO_THROW(dd3 = dd1.multiplyMatrix(dd2, {x.second}));
+    ASSERT_NO_THROW(dd3 = dd3.sumAbstract({x.first}));
+    ASSERT_NO_THROW(dd3 = dd1.sumAbstract({x.second}));
+    
+    storm::dd::DdStatistics const& statistics = manager->getStatistics();
+    EXPECT_EQ(1ull, statistics.getOperationStatistics(storm::dd::DdOperation::MultiplyMatrix).numberOfCalls);
+    EXPECT_EQ(2ull, statistics.getOperationStatistics(storm::dd::DdOperation::SumAbstract).numberOfCalls);
+    EXPECT_EQ(0ull, statistics.getOperationStatistics(storm::dd::DdOperation::RelationalProduct).numberOfCalls);
+    EXPECT_LE(1ull, statistics.getOperationStatistics(storm::dd::DdOperation::MultiplyMatrix).maximalNumberOfResultNodes);
+    
+    storm::dd::DdLibraryStatistics libraryStatistics = manager->getLibraryStatistics();
+    EXPECT_LE(libraryStatistics.cacheHits, libraryStatistics.cacheLookups);
+    EXPECT_LT(0ull, libraryStatistics.uniqueTableNodes);
+}
+
 TEST(CuddDd, GetSetValueTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
@@ -716,6 +739,40 @@ TEST(CuddDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(CuddDd, AddMultiplyWithExplicitVectorTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    
+    // Create a non-trivial matrix.
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd = manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>();
+    dd += manager->getEncoding(x.first, 1).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>() + manager->getEncoding(x.second, 1).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>();
+    
+    storm::dd::Odd rowOdd = manager->getRange(x.first).template toAdd<double>().createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).template toAdd<double>().createOdd();
+    storm::storage::SparseMatrix<double> matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+    
+    std::vector<double> vector(9);
+    for (uint_fast64_t i = 0; i < vector.size(); ++i) {
+        vector[i] = i + 1;
+    }
+    std::vector<double> expected(9);
+    matrix.multiplyWithVector(vector, expected);
+    
+    std::vector<double> result(9, 0.0);
+    ASSERT_NO_THROW(dd.multiplyWithExplicitVector(vector, result, {x.first}, {x.second}, rowOdd, columnOdd));
+    for (uint_fast64_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(expected[i], result[i]);
+    }
+    
+    // Entries in columns that are not contained in the column ODD must be ignored.
+    dd += manager->getRange(x.first).template toAdd<double>() * manager->template getConstant<double>(2);
+    std::fill(result.begin(), result.end(), 0.0);
+    ASSERT_NO_THROW(dd.multiplyWithExplicitVector(vector, result, {x.first}, {x.second}, rowOdd, columnOdd));
+    for (uint_fast64_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(expected[i] + 90, result[i]);
+    }
+}
+
 TEST(CuddDd, BddOddTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
@@ -3,6 +3,7 @@
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm-parsers/parser/FormulaParser.h"
 #include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
+#include "storm/api/bisimulation.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -59,6 +60,35 @@ TEST(DeterministicModelBisimulationDecomposition, Die) {
     EXPECT_EQ(8ul, result->getNumberOfTransitions());
 }
 
+TEST(DeterministicModelBisimulationDecomposition, DiePartitionCache) {
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", "");
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Dtmc);
+
+    storm::parser::FormulaParser formulaParser;
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = {formulaParser.parseSingleFormulaFromString("P=? [F \"one\"]")};
+    
+    storm::api::SparseBisimulationPartitionCache<double> cache;
+    std::shared_ptr<storm::models::sparse::Model<double>> result;
+    ASSERT_NO_THROW(result = storm::api::performBisimulationMinimization<double>(model, formulas, storm::storage::BisimulationType::Strong, &cache));
+    EXPECT_EQ(5ul, result->getNumberOfStates());
+    EXPECT_EQ(8ul, result->getNumberOfTransitions());
+    EXPECT_EQ(0ul, cache.getNumberOfHits());
+    EXPECT_EQ(1ul, cache.getNumberOfMisses());
+    
+    // The second query respects the same atomic propositions and therefore starts from the cached partition.
+    formulas = {formulaParser.parseSingleFormulaFromString("P=? [X \"one\"]")};
+    ASSERT_NO_THROW(result = storm::api::performBisimulationMinimization<double>(model, formulas, storm::storage::BisimulationType::Strong, &cache));
+    EXPECT_EQ(5ul, result->getNumberOfStates());
+    EXPECT_EQ(8ul, result->getNumberOfTransitions());
+    EXPECT_EQ(1ul, cache.getNumberOfHits());
+    
+    // Respecting all labels requires a new partition.
+    ASSERT_NO_THROW(result = storm::api::performBisimulationMinimization<double>(model, {}, storm::storage::BisimulationType::Strong, &cache));
+    EXPECT_EQ(13ul, result->getNumberOfStates());
+    EXPECT_EQ(20ul, result->getNumberOfTransitions());
+    EXPECT_EQ(2ul, cache.getNumberOfMisses());
+}
+
 TEST(DeterministicModelBisimulationDecomposition, Crowds) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
 
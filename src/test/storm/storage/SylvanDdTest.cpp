@@ -892,6 +892,40 @@ TEST(SylvanDd, AddToRationalTest) {
 }
 
 
+TEST(SylvanDd, AddMultiplyWithExplicitVectorTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
+    
+    // Create a non-trivial matrix.
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd = manager->template getIdentity<double>(x.first).equals(manager->template getIdentity<double>(x.second)).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>();
+    dd += manager->getEncoding(x.first, 1).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>() + manager->getEncoding(x.second, 1).template toAdd<double>() * manager->getRange(x.first).template toAdd<double>();
+    
+    storm::dd::Odd rowOdd = manager->getRange(x.first).template toAdd<double>().createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).template toAdd<double>().createOdd();
+    storm::storage::SparseMatrix<double> matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd);
+    
+    std::vector<double> vector(9);
+    for (uint_fast64_t i = 0; i < vector.size(); ++i) {
+        vector[i] = i + 1;
+    }
+    std::vector<double> expected(9);
+    matrix.multiplyWithVector(vector, expected);
+    
+    std::vector<double> result(9, 0.0);
+    ASSERT_NO_THROW(dd.multiplyWithExplicitVector(vector, result, {x.first}, {x.second}, rowOdd, columnOdd));
+    for (uint_fast64_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(expected[i], result[i]);
+    }
+    
+    // Entries in columns that are not contained in the column ODD must be ignored.
+    dd += manager->getRange(x.first).template toAdd<double>() * manager->template getConstant<double>(2);
+    std::fill(result.begin(), result.end(), 0.0);
+    ASSERT_NO_THROW(dd.multiplyWithExplicitVector(vector, result, {x.first}, {x.second}, rowOdd, columnOdd));
+    for (uint_fast64_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(expected[i] + 90, result[i]);
+    }
+}
+
 TEST(SylvanDd, BddOddTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");